@@ -0,0 +1,598 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include "graph.h"
+
+/*
+    gcc -o vc-bench -Wall -O2 bench.c graph.c stack.c bitset.c union_find.c bucket_queue.c -std=c99
+    or: make bench
+
+    generates a fixed set of graphs, writes them as DIMACS files and runs the solver binary on every graph with
+    the algorithms simple, maxdeg and maxdeg --warmstart, one line of CSV (or one JSON record) per run
+ */
+
+typedef enum BENCH_FAMILIES
+{
+    BENCH_ERDOS_RENYI,
+    BENCH_BARABASI_ALBERT,
+    BENCH_GRID,
+    BENCH_REGULAR,
+    BENCH_PLANTED,
+    BENCH_STAR
+} bench_family_t;
+
+struct _bench_family_name_s
+{
+    const char *name;
+    bench_family_t family;
+};
+typedef struct _bench_family_name_s bench_family_name_t;
+
+static const bench_family_name_t bench_family_names[] =
+{
+    { "er", BENCH_ERDOS_RENYI },
+    { "ba", BENCH_BARABASI_ALBERT },
+    { "grid", BENCH_GRID },
+    { "regular", BENCH_REGULAR },
+    { "planted", BENCH_PLANTED },
+    { "star", BENCH_STAR }
+};
+
+/* one graph of the sweep, the meaning of 'param' depends on the family: average degree (er, planted), edges per new vertex (ba), width (grid), degree (regular), unused (star) */
+struct _bench_instance_s
+{
+    bench_family_t family;
+    uint32_t n;
+    uint32_t param;
+};
+typedef struct _bench_instance_s bench_instance_t;
+
+static const bench_instance_t bench_sweep[] =
+{
+    { BENCH_ERDOS_RENYI, 40, 3 }, { BENCH_ERDOS_RENYI, 60, 3 }, { BENCH_ERDOS_RENYI, 80, 3 },
+    { BENCH_ERDOS_RENYI, 40, 6 }, { BENCH_ERDOS_RENYI, 60, 6 }, { BENCH_ERDOS_RENYI, 80, 6 },
+    { BENCH_BARABASI_ALBERT, 100, 2 }, { BENCH_BARABASI_ALBERT, 200, 2 }, { BENCH_BARABASI_ALBERT, 60, 3 },
+    { BENCH_GRID, 36, 6 }, { BENCH_GRID, 64, 8 }, { BENCH_GRID, 100, 10 },
+    { BENCH_REGULAR, 40, 3 }, { BENCH_REGULAR, 60, 3 }, { BENCH_REGULAR, 40, 4 },
+    { BENCH_PLANTED, 60, 4 }, { BENCH_PLANTED, 120, 4 }, { BENCH_PLANTED, 240, 4 },
+    { BENCH_STAR, 3, 0 }, { BENCH_STAR, 50, 0 }
+};
+
+static const bench_instance_t bench_quick_sweep[] =
+{
+    { BENCH_ERDOS_RENYI, 30, 3 }, { BENCH_BARABASI_ALBERT, 30, 2 }, { BENCH_GRID, 16, 4 }, { BENCH_REGULAR, 30, 3 }, { BENCH_PLANTED, 45, 4 }, { BENCH_STAR, 3, 0 }
+};
+
+/* 'name' is reported, 'algorithm' and 'option' (NULL if there is none) are passed to the solver */
+struct _bench_algorithm_s
+{
+    const char *name;
+    const char *algorithm;
+    const char *option;
+};
+typedef struct _bench_algorithm_s bench_algorithm_t;
+
+static const bench_algorithm_t bench_algorithms[] =
+{
+    { "simple", "simple", NULL },
+    { "maxdeg", "maxdeg", NULL },
+    { "maxdeg-warmstart", "maxdeg", "--warmstart" }
+};
+
+struct _bench_options_s
+{
+    const char *solver; /* path of the vc binary */
+    const char *directory; /* generated graphs and the statistics of the last run */
+    const char *time_limit; /* seconds per run, passed to --time-limit */
+    bool json; /* one JSON record per run instead of CSV */
+    bool quick;
+    uint64_t seed;
+    char **solver_options; /* passed to every run of the solver */
+    int num_solver_options;
+};
+typedef struct _bench_options_s bench_options_t;
+
+/* answer of one run of the solver, read from its --stats-json record */
+struct _bench_result_s
+{
+    char result[16];
+    uint64_t nodes;
+    double time;
+    double search_time;
+    uint64_t peak_memory;
+};
+typedef struct _bench_result_s bench_result_t;
+
+/* splitmix64, every instance has its own stream so that the sweep can change without changing the other graphs */
+uint64_t bench_random(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+uint32_t bench_random_below(uint64_t *state, uint32_t bound)
+{
+    return (uint32_t) (bench_random(state) % bound);
+}
+
+/* edges are kept in a flat list of vertex pairs (0-based) until the graph is complete, so that duplicates can be rejected */
+bool bench_has_edge(const uint8_t *matrix, uint32_t n, uint32_t u, uint32_t v)
+{
+    return matrix[(uint64_t) u * n + v] != 0;
+}
+
+void bench_add_edge(uint8_t *matrix, uint32_t n, stack_t *edges, uint32_t u, uint32_t v)
+{
+    if((u == v) || bench_has_edge(matrix, n, u, v))
+        return;
+
+    matrix[(uint64_t) u * n + v] = 1;
+    matrix[(uint64_t) v * n + u] = 1;
+    stack_push(edges, &u);
+    stack_push(edges, &v);
+}
+
+/* every pair is an edge with probability 'degree' / (n - 1) */
+void bench_erdos_renyi(uint64_t *state, uint32_t n, uint32_t degree, uint8_t *matrix, stack_t *edges)
+{
+    uint64_t threshold = (uint64_t) ((double) degree / (n - 1) * 4294967296.0);
+
+    for(uint32_t u = 0; u < n; u++)
+    {
+        for(uint32_t v = u + 1; v < n; v++)
+        {
+            if((bench_random(state) >> 32) < threshold)
+                bench_add_edge(matrix, n, edges, u, v);
+        }
+    }
+}
+
+/* preferential attachment: every new vertex connects to 'links' vertices, chosen with probability proportional to their degree */
+void bench_barabasi_albert(uint64_t *state, uint32_t n, uint32_t links, uint8_t *matrix, stack_t *edges)
+{
+    /* a clique of links + 1 vertices to start with */
+    for(uint32_t u = 0; u <= links; u++)
+    {
+        for(uint32_t v = u + 1; v <= links; v++)
+            bench_add_edge(matrix, n, edges, u, v);
+    }
+
+    for(uint32_t u = links + 1; u < n; u++)
+    {
+        uint32_t added = 0, endpoints = stack_height(edges);
+
+        /* a random endpoint of a random edge is a vertex chosen proportionally to its degree */
+        while(added < links)
+        {
+            vertex_t v = *(vertex_t *) stack_get_element_ptr(edges, bench_random_below(state, endpoints));
+            if(!bench_has_edge(matrix, n, u, v))
+            {
+                bench_add_edge(matrix, n, edges, u, v);
+                added++;
+            }
+        }
+    }
+}
+
+/* 'width' columns and n / 'width' rows, the graph is bipartite and its minimum vc has floor(n / 2) vertices */
+void bench_grid(uint32_t n, uint32_t width, uint8_t *matrix, stack_t *edges)
+{
+    for(uint32_t u = 0; u < n; u++)
+    {
+        if((u % width) + 1 < width)
+            bench_add_edge(matrix, n, edges, u, u + 1);
+        if(u + width < n)
+            bench_add_edge(matrix, n, edges, u, u + width);
+    }
+}
+
+/* pairs 'degree' copies of every vertex at random, pairings with loops or multiple edges are discarded */
+bool bench_regular(uint64_t *state, uint32_t n, uint32_t degree, uint8_t *matrix, stack_t *edges)
+{
+    uint32_t *points, num_points = n * degree;
+    bool simple = false;
+
+    if(num_points % 2 != 0)
+        return false;
+
+    points = (uint32_t *) malloc(sizeof(uint32_t) * num_points);
+    if(points == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to pair vertices\n");
+        exit(0);
+    }
+
+    for(int attempt = 0; !simple && (attempt < 1000); attempt++)
+    {
+        for(uint32_t i = 0; i < num_points; i++)
+            points[i] = i / degree;
+        for(uint32_t i = num_points - 1; i > 0; i--)
+        {
+            uint32_t j = bench_random_below(state, i + 1), t = points[i];
+            points[i] = points[j];
+            points[j] = t;
+        }
+
+        memset(matrix, 0, (size_t) n * n);
+        while(!stack_isempty(edges))
+            stack_remove_last(edges);
+        simple = true;
+        for(uint32_t i = 0; simple && (i < num_points); i += 2)
+        {
+            simple = (points[i] != points[i + 1]) && !bench_has_edge(matrix, n, points[i], points[i + 1]);
+            bench_add_edge(matrix, n, edges, points[i], points[i + 1]);
+        }
+    }
+
+    free(points);
+    return simple;
+}
+
+/*
+    the first n / 3 vertices form the planted vc, every one of them is matched to a vertex outside, so the matching shows
+    that the planted vc is minimum. further random edges with at least one endpoint in the vc raise the average degree
+ */
+uint32_t bench_planted(uint64_t *state, uint32_t n, uint32_t degree, uint8_t *matrix, stack_t *edges)
+{
+    uint32_t size = n / 3, target = n * degree / 2;
+
+    for(uint32_t u = 0; u < size; u++)
+        bench_add_edge(matrix, n, edges, u, size + u);
+
+    for(uint64_t tries = 0; (stack_height(edges) / 2 < target) && (tries < 100ull * target); tries++)
+        bench_add_edge(matrix, n, edges, bench_random_below(state, size), bench_random_below(state, n));
+
+    return size;
+}
+
+/* the first vertex is adjacent to all others, its minimum vc is the first vertex alone */
+void bench_star(uint32_t n, uint8_t *matrix, stack_t *edges)
+{
+    for(uint32_t v = 1; v < n; v++)
+        bench_add_edge(matrix, n, edges, 0, v);
+}
+
+/* generates an instance into 'graph', returns the size of a minimum vc if the generator knows it, -1 otherwise */
+int bench_generate(const bench_instance_t const *instance, uint64_t seed, graph_t *graph)
+{
+    uint64_t state = seed ^ ((uint64_t) instance->family << 48) ^ ((uint64_t) instance->n << 16) ^ instance->param;
+    uint32_t n = instance->n;
+    uint8_t *matrix;
+    stack_t edges;
+    gbuild_t builder;
+    int optimum = -1;
+
+    matrix = (uint8_t *) calloc((size_t) n * n, 1);
+    if(matrix == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store adjacency matrix\n");
+        exit(0);
+    }
+    stack_init(&edges, sizeof(vertex_t));
+
+    switch(instance->family)
+    {
+        case BENCH_ERDOS_RENYI:
+            bench_erdos_renyi(&state, n, instance->param, matrix, &edges);
+            break;
+        case BENCH_BARABASI_ALBERT:
+            bench_barabasi_albert(&state, n, instance->param, matrix, &edges);
+            break;
+        case BENCH_GRID:
+            bench_grid(n, instance->param, matrix, &edges);
+            optimum = (int) (n / 2);
+            break;
+        case BENCH_REGULAR:
+            if(!bench_regular(&state, n, instance->param, matrix, &edges))
+                fprintf(stderr, "[error] could not pair the vertices of a %u-regular graph with %u vertices\n", instance->param, n);
+            break;
+        case BENCH_PLANTED:
+            optimum = (int) bench_planted(&state, n, instance->param, matrix, &edges);
+            break;
+        case BENCH_STAR:
+            bench_star(n, matrix, &edges);
+            optimum = 1;
+            break;
+    }
+
+    /* labels are 1-based as in DIMACS files */
+    gbuild_init(&builder);
+    for(uint32_t i = 0; i < stack_height(&edges); i += 2)
+        if(!gbuild_add_edge(&builder, *(vertex_t *) stack_get_element_ptr(&edges, i) + 1, *(vertex_t *) stack_get_element_ptr(&edges, i + 1) + 1))
+            exit(0);
+    if(!gbuild_create_graph(&builder, graph))
+        exit(0);
+    gbuild_destroy(&builder);
+
+    stack_destroy(&edges);
+    free(matrix);
+
+    return optimum;
+}
+
+/* checks that the planted vc of an instance covers all edges, the matching makes sure that it is minimum */
+bool bench_verify_planted(const bench_instance_t const *instance, const graph_t const *graph)
+{
+    bitset_t cover;
+    vertex_t vertex;
+    bool valid;
+
+    bitset_init(&cover, (bitset_index_t) graph_num_vertices(graph));
+    for(vertex_label_t label = 1; label <= instance->n / 3; label++)
+    {
+        if(graph_get_vertex_by_label(graph, label, &vertex))
+            bitset_set(&cover, (bitset_index_t) vertex);
+    }
+    valid = graph_verify_cover(graph, &cover);
+    bitset_destroy(&cover);
+
+    return valid;
+}
+
+/* reads the value that follows '"key": ' in a JSON record */
+const char *bench_json_value(const char *record, const char *key)
+{
+    char pattern[64];
+    const char *value;
+
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+    value = strstr(record, pattern);
+    return value ? value + strlen(pattern) : NULL;
+}
+
+/* appends an argument to a shell command, quoted so that the shell passes it on unchanged */
+void bench_append_argument(char *command, size_t size, const char *argument)
+{
+    size_t length = strlen(command);
+
+    if(length + 2 < size)
+    {
+        command[length++] = ' ';
+        command[length++] = '\'';
+    }
+    for(const char *c = argument; *c && (length + 5 < size); c++)
+    {
+        if(*c == '\'')
+        {
+            memcpy(command + length, "'\\''", 4);
+            length += 4;
+        }
+        else
+            command[length++] = *c;
+    }
+    if(length + 1 < size)
+        command[length++] = '\'';
+    command[length] = '\0';
+}
+
+/* runs the solver on a graph file and reads its statistics, returns false if it did not write them */
+bool bench_run(const bench_options_t const *options, const char *filename, int k, const char *algorithm, const char *option, bool optimize, bench_result_t *result)
+{
+    char stats_filename[1024], k_string[16], record[4096], command[8192] = "";
+    const char *value;
+    FILE *fd;
+    size_t length;
+
+    snprintf(stats_filename, sizeof(stats_filename), "%s/last.json", options->directory);
+    snprintf(k_string, sizeof(k_string), "%i", k);
+    remove(stats_filename);
+
+    bench_append_argument(command, sizeof(command), options->solver);
+    bench_append_argument(command, sizeof(command), filename);
+    bench_append_argument(command, sizeof(command), k_string);
+    bench_append_argument(command, sizeof(command), algorithm);
+    bench_append_argument(command, sizeof(command), "--stats-json");
+    bench_append_argument(command, sizeof(command), stats_filename);
+    bench_append_argument(command, sizeof(command), "--time-limit");
+    bench_append_argument(command, sizeof(command), options->time_limit);
+    if(optimize)
+        bench_append_argument(command, sizeof(command), "--optimize");
+    if(option)
+        bench_append_argument(command, sizeof(command), option);
+    for(int i = 0; i < options->num_solver_options; i++)
+        bench_append_argument(command, sizeof(command), options->solver_options[i]);
+
+    /* the answer is taken from the statistics, the output of the solver is not needed */
+    strncat(command, " >/dev/null", sizeof(command) - strlen(command) - 1);
+    if(system(command) == -1)
+    {
+        fprintf(stderr, "[error] could not run %s (%s)\n", options->solver, strerror(errno));
+        return false;
+    }
+
+    if((fd = fopen(stats_filename, "rb")) == NULL)
+        return false;
+    length = fread(record, 1, sizeof(record) - 1, fd);
+    record[length] = '\0';
+    fclose(fd);
+
+    memset(result, 0, sizeof(bench_result_t));
+    if((value = bench_json_value(record, "result")) == NULL)
+        return false;
+    sscanf(value, "\"%15[A-Z]\"", result->result);
+    if((value = bench_json_value(record, "nodes")))
+        result->nodes = strtoull(value, NULL, 10);
+    if((value = bench_json_value(record, "time")))
+        result->time = atof(value);
+    if((value = bench_json_value(record, "search")))
+        result->search_time = atof(value);
+    if((value = bench_json_value(record, "peak_memory_kib")))
+        result->peak_memory = strtoull(value, NULL, 10);
+    if(optimize && !strcmp(result->result, "YES") && (value = bench_json_value(record, "size")))
+        snprintf(result->result, sizeof(result->result), "%i", atoi(value));
+
+    return true;
+}
+
+/* writes one run as a line of CSV or a JSON record, 'check' tells whether the answer agrees with the known optimum */
+void bench_report(FILE *out, const bench_options_t const *options, const char *instance_name, const bench_instance_t const *instance, const graph_t const *graph,
+    const char *algorithm, int k, int optimum, const bench_result_t const *result, const char *check)
+{
+    const char *family = bench_family_names[instance->family].name;
+
+    if(options->json)
+        fprintf(out, "{\"instance\": \"%s\", \"family\": \"%s\", \"vertices\": %u, \"edges\": %u, \"algorithm\": \"%s\", \"k\": %i, \"optimum\": %i, "
+            "\"result\": \"%s\", \"nodes\": %" PRIu64 ", \"time\": %.3f, \"search_time\": %.3f, \"peak_memory_kib\": %" PRIu64 ", \"check\": \"%s\"}\n",
+            instance_name, family, graph_num_vertices(graph), graph_num_edges(graph), algorithm, k, optimum,
+            result->result, result->nodes, result->time, result->search_time, result->peak_memory, check);
+    else
+        fprintf(out, "%s,%s,%u,%u,%s,%i,%i,%s,%" PRIu64 ",%.3f,%.3f,%" PRIu64 ",%s\n",
+            instance_name, family, graph_num_vertices(graph), graph_num_edges(graph), algorithm, k, optimum,
+            result->result, result->nodes, result->time, result->search_time, result->peak_memory, check);
+    fflush(out);
+}
+
+/* solves one instance with every algorithm at k = optimum - 1 and k = optimum, returns the number of wrong answers */
+int bench_instance(FILE *out, const bench_options_t const *options, const bench_instance_t const *instance)
+{
+    char instance_name[64], filename[1024];
+    bench_result_t result;
+    graph_t graph;
+    int optimum, wrong = 0;
+
+    snprintf(instance_name, sizeof(instance_name), "%s-%u-%u", bench_family_names[instance->family].name, instance->n, instance->param);
+    snprintf(filename, sizeof(filename), "%s/%s.dgf", options->directory, instance_name);
+
+    optimum = bench_generate(instance, options->seed, &graph);
+    if((instance->family == BENCH_PLANTED) && !bench_verify_planted(instance, &graph))
+    {
+        fprintf(stderr, "[error] planted vc of %s does not cover all edges\n", instance_name);
+        wrong++;
+    }
+    if(!graph_save_dimacs(&graph, filename))
+    {
+        graph_destroy(&graph);
+        return wrong + 1;
+    }
+    fprintf(stderr, "[info] %s: %u vertices, %u edges\n", instance_name, graph_num_vertices(&graph), graph_num_edges(&graph));
+
+    /* maxdeg finds the optimum of the families that do not know it, the run is reported as well */
+    if(optimum < 0)
+    {
+        if(!bench_run(options, filename, 0, "maxdeg", NULL, true, &result))
+        {
+            fprintf(stderr, "[error] solver did not report on %s\n", filename);
+            graph_destroy(&graph);
+            return wrong + 1;
+        }
+        bench_report(out, options, instance_name, instance, &graph, "maxdeg-optimize", 0, -1, &result, "");
+        if(strcmp(result.result, "NO") && strcmp(result.result, "UNKNOWN"))
+            optimum = atoi(result.result);
+    }
+
+    for(int i = 0; (optimum > 0) && (i < sizeof(bench_algorithms) / sizeof(bench_algorithms[0])); i++)
+    {
+        for(int k = optimum - 1; k <= optimum; k++)
+        {
+            const char *expected = (k == optimum) ? "YES" : "NO", *check = "ok";
+
+            if(!bench_run(options, filename, k, bench_algorithms[i].algorithm, bench_algorithms[i].option, false, &result))
+            {
+                fprintf(stderr, "[error] solver did not report on %s\n", filename);
+                wrong++;
+                continue;
+            }
+            if(!strcmp(result.result, "UNKNOWN"))
+                check = "timeout";
+            else if(strcmp(result.result, expected))
+            {
+                check = "wrong";
+                wrong++;
+            }
+            bench_report(out, options, instance_name, instance, &graph, bench_algorithms[i].name, k, optimum, &result, check);
+        }
+    }
+
+    graph_destroy(&graph);
+    return wrong;
+}
+
+int main(int argc, char **argv)
+{
+    bench_options_t options;
+    const bench_instance_t *sweep;
+    uint32_t num_instances;
+    const char *out_filename = NULL;
+    FILE *out = stdout;
+    int wrong = 0;
+
+    options.solver = "./vc";
+    options.directory = "bench-graphs";
+    options.time_limit = "10";
+    options.json = false;
+    options.quick = false;
+    options.seed = 1;
+    options.solver_options = NULL;
+    options.num_solver_options = 0;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "--solver") && (i + 1 < argc))
+            options.solver = argv[++i];
+        else if(!strcmp(argv[i], "--dir") && (i + 1 < argc))
+            options.directory = argv[++i];
+        else if(!strcmp(argv[i], "--time-limit") && (i + 1 < argc))
+            options.time_limit = argv[++i];
+        else if(!strcmp(argv[i], "--seed") && (i + 1 < argc))
+            options.seed = strtoull(argv[++i], NULL, 10);
+        else if(!strcmp(argv[i], "--out") && (i + 1 < argc))
+            out_filename = argv[++i];
+        else if(!strcmp(argv[i], "--json"))
+            options.json = true;
+        else if(!strcmp(argv[i], "--quick"))
+            options.quick = true;
+        else if(!strcmp(argv[i], "--"))
+        {
+            options.solver_options = argv + i + 1;
+            options.num_solver_options = argc - i - 1;
+            break;
+        }
+        else
+        {
+            fprintf(stdout, "Usage: %s [options] [-- <solver options>]\n", argv[0]);
+            fprintf(stdout, "  generates Erdos-Renyi, Barabasi-Albert, grid, random regular, planted-vc and star graphs and solves each of them\n");
+            fprintf(stdout, "  with simple, maxdeg and maxdeg --warmstart at k = optimum - 1 and k = optimum, one line of CSV per run\n");
+            fprintf(stdout, " Available options:\n");
+            fprintf(stdout, "  --solver <path>  vc binary to benchmark (default: ./vc)\n");
+            fprintf(stdout, "  --dir <path>     directory of the generated graphs (default: bench-graphs)\n");
+            fprintf(stdout, "  --time-limit <s> seconds per run, slower runs answer UNKNOWN (default: 10)\n");
+            fprintf(stdout, "  --seed <n>       seed of the generators (default: 1)\n");
+            fprintf(stdout, "  --out <file>     writes the results to a file instead of stdout\n");
+            fprintf(stdout, "  --json           one JSON record per run instead of CSV\n");
+            fprintf(stdout, "  --quick          a small sweep that finishes in seconds\n");
+            fprintf(stdout, " The exit status is 1 if any answer contradicts a known optimum.\n");
+            return 0;
+        }
+    }
+
+    if((mkdir(options.directory, 0755) != 0) && (errno != EEXIST))
+    {
+        fprintf(stdout, "[error] could not create directory %s (%s)\n", options.directory, strerror(errno));
+        return 1;
+    }
+    if(out_filename && ((out = fopen(out_filename, "w")) == NULL))
+    {
+        fprintf(stdout, "[error] could not open %s for writing (%s)\n", out_filename, strerror(errno));
+        return 1;
+    }
+
+    sweep = options.quick ? bench_quick_sweep : bench_sweep;
+    num_instances = options.quick ? sizeof(bench_quick_sweep) / sizeof(bench_quick_sweep[0]) : sizeof(bench_sweep) / sizeof(bench_sweep[0]);
+
+    if(!options.json)
+        fprintf(out, "instance,family,vertices,edges,algorithm,k,optimum,result,nodes,time,search_time,peak_memory_kib,check\n");
+    for(uint32_t i = 0; i < num_instances; i++)
+        wrong += bench_instance(out, &options, &sweep[i]);
+
+    if(out != stdout)
+        fclose(out);
+    if(wrong > 0)
+        fprintf(stderr, "[error] %i runs did not agree with the known optimum\n", wrong);
+
+    return (wrong > 0) ? 1 : 0;
+}
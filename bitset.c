@@ -5,7 +5,7 @@
  * @brief Creates a new bitset data structure.
  * @details Allocates memory for a bitset that can contain values from the range `[0, num_values - 1]` and initializes it using bitset_init.
  * @param num_values Number of values the set can store.
- * @returns Pointer to a bitset data structure.
+ * @returns Pointer to a bitset data structure, or `NULL` if memory ran out.
  * @remark Memory needs to be free'd by bitset_free.
  */
 bitset_t *bitset_new(bitset_index_t num_values)
@@ -14,10 +14,14 @@ bitset_t *bitset_new(bitset_index_t num_values)
     if(set == NULL)
     {
         fprintf(stderr, "[bitset] Error: could not allocate memory to store bitset\n");
-        exit(0);
+        return NULL;
     }
     
-    bitset_init(set, num_values);
+    if(!bitset_init(set, num_values))
+    {
+        free(set);
+        return NULL;
+    }
     return set;
 }
 
@@ -26,9 +30,10 @@ bitset_t *bitset_new(bitset_index_t num_values)
  * @details Initializes a bitset so that it can contain values from the range `[0, num_values - 1]`.
  * @param set Pointer to an unitialized bitset data structure.
  * @param num_values Number of values the set can store.
+ * @returns `true` on success, `false` if memory ran out, the set can be destroyed either way.
  * @remark Allocates O(`num_values`) memory.
  */
-void bitset_init(bitset_t *set, bitset_index_t num_values)
+bool bitset_init(bitset_t *set, bitset_index_t num_values)
 {
 #ifdef BITSET_ASSERTIONS
     assert(set);
@@ -39,10 +44,12 @@ void bitset_init(bitset_t *set, bitset_index_t num_values)
     if(set->bits == NULL)
     {
         fprintf(stderr, "[bitset] Error: could not allocate memory to store bitset data\n");
-        exit(0);
+        set->max = 0;
+        return false;
     }
     
     bitset_clear_all(set);
+    return true;
 }
 
 /**
@@ -50,16 +57,19 @@ void bitset_init(bitset_t *set, bitset_index_t num_values)
  * @details Initializes `set` with the same size of `source` and copies all values of `source` to `set`.
  * @param set Pointer to an unitialized bitset data structure.
  * @param source Pointer to an itialized bitset data structure that is to be copied.
+ * @returns `true` on success, `false` if memory ran out, the set can be destroyed either way.
  */
-void bitset_init_copy(bitset_t *set, const bitset_t const *source)
+bool bitset_init_copy(bitset_t *set, const bitset_t const *source)
 {
 #ifdef BITSET_ASSERTIONS
     assert(set);
     assert(source);
 #endif
 
-    bitset_init(set, source->max);
+    if(!bitset_init(set, source->max))
+        return false;
     bitset_copy(set, source);
+    return true;
 }
 
 /**
@@ -461,3 +471,30 @@ int bitset_cmp(const bitset_t const *a, const bitset_t const *b)
     return memcmp(a->bits, b->bits, BITSET_NUM_DATA_ELEMENTS(a->max) * sizeof(bitset_data_t));
 }
 
+/**
+ * @brief Computes a hash of the elements of a set.
+ * @details Mixes the memory of the set in words of 64 bits, equal sets (see bitset_cmp) have equal hashes.
+ * @param set Pointer to an initialized bitset data structure.
+ * @returns Hash of the set.
+ * @remark Takes O(`max` / 64) time.
+ */
+uint64_t bitset_hash(const bitset_t const *set)
+{
+    size_t num_bytes, i;
+    uint64_t hash, word;
+#ifdef BITSET_ASSERTIONS
+    assert(set);
+#endif
+
+    num_bytes = BITSET_NUM_DATA_ELEMENTS(set->max) * sizeof(bitset_data_t);
+    hash = 0x9e3779b97f4a7c15ull ^ num_bytes;
+    for(i = 0; i < num_bytes; i += sizeof(uint64_t))
+    {
+        word = 0;
+        memcpy(&word, (const uint8_t *) set->bits + i, (num_bytes - i < sizeof(uint64_t)) ? num_bytes - i : sizeof(uint64_t));
+        hash = (hash ^ word) * 0xff51afd7ed558ccdull;
+        hash ^= hash >> 32;
+    }
+
+    return hash ^ (hash >> 29);
+}
@@ -35,8 +35,8 @@ typedef struct _bitset_s bitset_t;
 #define BITSET_BITS_PER_ELEMENT (8 * sizeof(bitset_data_t))
 
 bitset_t *bitset_new(bitset_index_t num_values);
-void bitset_init(bitset_t *set, bitset_index_t num_values);
-void bitset_init_copy(bitset_t *set, const bitset_t const *source);
+bool bitset_init(bitset_t *set, bitset_index_t num_values);
+bool bitset_init_copy(bitset_t *set, const bitset_t const *source);
 void bitset_copy(bitset_t *set, const bitset_t const *source);
 void bitset_destroy(bitset_t *set);
 void bitset_free(bitset_t *set);
@@ -52,6 +52,7 @@ void bitset_print(const bitset_t const *set);
 void bitset_remove_set(bitset_t *set, const bitset_t const *remove_set);
 bool bitset_contains_set(const bitset_t const *set, const bitset_t const *subset);
 int bitset_cmp(const bitset_t const *a, const bitset_t const *b);
+uint64_t bitset_hash(const bitset_t const *set);
 
 /** @} */
 
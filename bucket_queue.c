@@ -0,0 +1,265 @@
+#include <assert.h>
+#include <string.h>
+#include "bucket_queue.h"
+
+/**
+ * @brief Initializes an empty bucket queue.
+ * @details Every element is stored in the bucket of its key, buckets are doubly linked lists. The queue keeps lower and upper bounds on the keys of non-empty buckets which are tightened lazily, so that finding an element with minimum or maximum key costs amortised O(1) as long as keys change by small steps.
+ * @param queue Pointer to an uninitialized bucket queue.
+ * @param num_nodes Number of elements, valid elements are in the range `[0, num_nodes - 1]`.
+ * @param num_keys Number of buckets, valid keys are in the range `[0, num_keys - 1]`.
+ * @returns `true` on success, `false` if memory ran out, the queue can be destroyed either way.
+ * @remark Allocates O(`num_nodes` + `num_keys`) memory.
+ */
+bool bq_init(bq_t *queue, bq_node_t num_nodes, bq_node_t num_keys)
+{
+    bq_node_t i;
+
+    assert(queue);
+    assert(num_keys > 0);
+
+    queue->num_nodes = num_nodes;
+    queue->num_keys = num_keys;
+    queue->size = 0;
+    queue->min_key = num_keys;
+    queue->max_key = 0;
+
+    /* allocate at least one element to avoid malloc(0) */
+    queue->keys = (bq_node_t *) malloc(sizeof(bq_node_t) * (3 * ((size_t) num_nodes) + num_keys + 1));
+    if(queue->keys == NULL)
+    {
+        fprintf(stderr, "[bq] Error: could not allocate memory to store bucket queue\n");
+        queue->next = queue->prev = queue->heads = NULL;
+        return false;
+    }
+
+    queue->next = queue->keys + num_nodes;
+    queue->prev = queue->next + num_nodes;
+    queue->heads = queue->prev + num_nodes;
+
+    for(i = 0; i < num_nodes; i++)
+        queue->keys[i] = BQ_NONE;
+    for(i = 0; i < num_keys; i++)
+        queue->heads[i] = BQ_NONE;
+    return true;
+}
+
+/**
+ * @brief Creates a copy of a bucket queue.
+ * @param queue Pointer to an uninitialized bucket queue.
+ * @param source Pointer to an initialized bucket queue that is to be copied.
+ * @returns `true` on success, `false` if memory ran out, see bq_init.
+ */
+bool bq_init_copy(bq_t *queue, const bq_t const *source)
+{
+    assert(queue);
+    assert(source);
+
+    if(!bq_init(queue, source->num_nodes, source->num_keys))
+        return false;
+    bq_copy(queue, source);
+    return true;
+}
+
+/**
+ * @brief Copies all elements and keys from one bucket queue to another.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param source Pointer to an initialized bucket queue of the same dimensions.
+ */
+void bq_copy(bq_t *queue, const bq_t const *source)
+{
+    assert(queue);
+    assert(source);
+    assert(queue->num_nodes == source->num_nodes);
+    assert(queue->num_keys == source->num_keys);
+
+    queue->size = source->size;
+    queue->min_key = source->min_key;
+    queue->max_key = source->max_key;
+    memcpy(queue->keys, source->keys, sizeof(bq_node_t) * (3 * ((size_t) source->num_nodes) + source->num_keys));
+}
+
+/**
+ * @brief Frees memory that was allocated by bq_init.
+ * @param queue Pointer to an initialized bucket queue.
+ */
+void bq_destroy(bq_t *queue)
+{
+    assert(queue);
+
+    free(queue->keys);
+    queue->keys = NULL;
+    queue->next = NULL;
+    queue->prev = NULL;
+    queue->heads = NULL;
+}
+
+/**
+ * @brief Inserts an element.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element that is not contained in the queue.
+ * @param key Key of the element.
+ */
+void bq_insert(bq_t *queue, bq_node_t node, bq_node_t key)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+    assert(key < queue->num_keys);
+    assert(queue->keys[node] == BQ_NONE);
+
+    queue->keys[node] = key;
+    queue->prev[node] = BQ_NONE;
+    queue->next[node] = queue->heads[key];
+    if(queue->heads[key] != BQ_NONE)
+        queue->prev[queue->heads[key]] = node;
+    queue->heads[key] = node;
+    queue->size++;
+
+    if(key < queue->min_key)
+        queue->min_key = key;
+    if(key > queue->max_key)
+        queue->max_key = key;
+}
+
+/**
+ * @brief Removes an element.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element that is contained in the queue.
+ */
+void bq_remove(bq_t *queue, bq_node_t node)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+    assert(queue->keys[node] != BQ_NONE);
+
+    if(queue->prev[node] != BQ_NONE)
+        queue->next[queue->prev[node]] = queue->next[node];
+    else
+        queue->heads[queue->keys[node]] = queue->next[node];
+
+    if(queue->next[node] != BQ_NONE)
+        queue->prev[queue->next[node]] = queue->prev[node];
+
+    queue->keys[node] = BQ_NONE;
+    queue->size--;
+}
+
+/**
+ * @brief Moves an element to another bucket.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element that is contained in the queue.
+ * @param key New key of the element.
+ */
+void bq_update(bq_t *queue, bq_node_t node, bq_node_t key)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+
+    if(queue->keys[node] == key)
+        return;
+
+    bq_remove(queue, node);
+    bq_insert(queue, node, key);
+}
+
+/**
+ * @brief Tests whether an element is contained in a bucket queue.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element.
+ * @returns `true` if `node` is contained, `false` otherwise.
+ */
+bool bq_contains(const bq_t const *queue, bq_node_t node)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+
+    return (queue->keys[node] != BQ_NONE);
+}
+
+/**
+ * @brief Returns the key of an element.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element.
+ * @returns Key of `node` or `BQ_NONE` if it is not contained.
+ */
+bq_node_t bq_key(const bq_t const *queue, bq_node_t node)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+
+    return queue->keys[node];
+}
+
+/**
+ * @brief Returns the first element of a bucket.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param key Key of the bucket.
+ * @returns First element with key `key` or `BQ_NONE` if the bucket is empty.
+ * @remark Changing the queue while walking a bucket with bq_next invalidates the walk.
+ */
+bq_node_t bq_first(const bq_t const *queue, bq_node_t key)
+{
+    assert(queue);
+
+    if(key >= queue->num_keys)
+        return BQ_NONE;
+    return queue->heads[key];
+}
+
+/**
+ * @brief Returns the successor of an element inside its bucket.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Element that is contained in the queue.
+ * @returns Next element of the same bucket or `BQ_NONE` if `node` is the last one.
+ */
+bq_node_t bq_next(const bq_t const *queue, bq_node_t node)
+{
+    assert(queue);
+    assert(node < queue->num_nodes);
+
+    return queue->next[node];
+}
+
+/**
+ * @brief Finds an element with minimum key.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Address to store the element at.
+ * @param key Address to store the key of the element at.
+ * @returns `true` if an element was found, `false` if the queue is empty.
+ */
+bool bq_find_min(bq_t *queue, bq_node_t *node, bq_node_t *key)
+{
+    assert(queue);
+
+    if(queue->size == 0)
+        return false;
+
+    while(queue->heads[queue->min_key] == BQ_NONE)
+        queue->min_key++;
+
+    *node = queue->heads[queue->min_key];
+    *key = queue->min_key;
+    return true;
+}
+
+/**
+ * @brief Finds an element with maximum key.
+ * @param queue Pointer to an initialized bucket queue.
+ * @param node Address to store the element at.
+ * @param key Address to store the key of the element at.
+ * @returns `true` if an element was found, `false` if the queue is empty.
+ */
+bool bq_find_max(bq_t *queue, bq_node_t *node, bq_node_t *key)
+{
+    assert(queue);
+
+    if(queue->size == 0)
+        return false;
+
+    while(queue->heads[queue->max_key] == BQ_NONE)
+        queue->max_key--;
+
+    *node = queue->heads[queue->max_key];
+    *key = queue->max_key;
+    return true;
+}
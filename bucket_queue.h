@@ -0,0 +1,59 @@
+#ifndef BUCKET_QUEUE_H_INCLUDED
+#define BUCKET_QUEUE_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @defgroup BucketQueue Bucket Queue
+ * @{
+ */
+
+/** @brief Type of elements and keys. */
+typedef uint32_t bq_node_t;
+
+/** @brief Marks the end of a bucket and elements that are not contained in the queue. */
+#define BQ_NONE UINT32_MAX
+
+struct _bucket_queue_s
+{
+    /** @brief Number of elements this structure keeps track of. Valid elements are in the range `[0, num_nodes - 1]`. */
+    bq_node_t num_nodes;
+    /** @brief Number of buckets. Valid keys are in the range `[0, num_keys - 1]`. */
+    bq_node_t num_keys;
+    /** @brief Number of elements that are contained in the queue. */
+    bq_node_t size;
+    /** @brief Lower bound on the smallest key of a non-empty bucket. */
+    bq_node_t min_key;
+    /** @brief Upper bound on the greatest key of a non-empty bucket. */
+    bq_node_t max_key;
+    /** @brief Key of every element, `BQ_NONE` if it is not contained. */
+    bq_node_t *keys;
+    /** @brief Successor of every element in its bucket. */
+    bq_node_t *next;
+    /** @brief Predecessor of every element in its bucket. */
+    bq_node_t *prev;
+    /** @brief First element of every bucket. */
+    bq_node_t *heads;
+};
+typedef struct _bucket_queue_s bq_t;
+
+bool bq_init(bq_t *queue, bq_node_t num_nodes, bq_node_t num_keys);
+bool bq_init_copy(bq_t *queue, const bq_t const *source);
+void bq_copy(bq_t *queue, const bq_t const *source);
+void bq_destroy(bq_t *queue);
+void bq_insert(bq_t *queue, bq_node_t node, bq_node_t key);
+void bq_remove(bq_t *queue, bq_node_t node);
+void bq_update(bq_t *queue, bq_node_t node, bq_node_t key);
+bool bq_contains(const bq_t const *queue, bq_node_t node);
+bq_node_t bq_key(const bq_t const *queue, bq_node_t node);
+bq_node_t bq_first(const bq_t const *queue, bq_node_t key);
+bq_node_t bq_next(const bq_t const *queue, bq_node_t node);
+bool bq_find_min(bq_t *queue, bq_node_t *node, bq_node_t *key);
+bool bq_find_max(bq_t *queue, bq_node_t *node, bq_node_t *key);
+
+/** @} */
+
+#endif
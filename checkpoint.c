@@ -0,0 +1,264 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <string.h>
+#include <unistd.h>
+#include "checkpoint.h"
+
+/**
+ * @brief Writes one snapshot to the temporary file and renames it to the checkpoint file.
+ */
+static bool ckpt_write(const ckpt_t const *ckpt, const uint8_t *data, uint32_t size)
+{
+    FILE *file;
+    bool success;
+
+    file = fopen(ckpt->temp_filename, "wb");
+    if(file == NULL)
+        return false;
+
+    success = (fwrite(data, 1, size, file) == size) && (fflush(file) == 0) && (fsync(fileno(file)) == 0);
+    success = (fclose(file) == 0) && success;
+
+    return success && (rename(ckpt->temp_filename, ckpt->filename) == 0);
+}
+
+/**
+ * @brief Main function of the writer thread, writes pending snapshots until ckpt_destroy stops it.
+ */
+static void *ckpt_writer(void *data)
+{
+    ckpt_t *ckpt = (ckpt_t *) data;
+    uint8_t *buffer;
+    uint32_t size, capacity;
+
+    pthread_mutex_lock(&(ckpt->lock));
+    for(;;)
+    {
+        while(!ckpt->has_pending && !ckpt->stopping)
+            pthread_cond_wait(&(ckpt->wake), &(ckpt->lock));
+        if(!ckpt->has_pending)
+            break;
+
+        /* the searcher fills the other buffer while this one is written */
+        buffer = ckpt->pending;
+        capacity = ckpt->pending_capacity;
+        size = ckpt->pending_size;
+        ckpt->pending = ckpt->writing;
+        ckpt->pending_capacity = ckpt->writing_capacity;
+        ckpt->writing = buffer;
+        ckpt->writing_capacity = capacity;
+        ckpt->has_pending = false;
+        ckpt->busy = true;
+        pthread_mutex_unlock(&(ckpt->lock));
+
+        if(!ckpt_write(ckpt, buffer, size) && !ckpt->failed)
+        {
+            fprintf(stderr, "[checkpoint] Error: could not write checkpoint to %s\n", ckpt->filename);
+            ckpt->failed = true;
+        }
+
+        pthread_mutex_lock(&(ckpt->lock));
+        ckpt->busy = false;
+        pthread_cond_broadcast(&(ckpt->idle));
+    }
+    pthread_mutex_unlock(&(ckpt->lock));
+
+    return NULL;
+}
+
+/**
+ * @brief Initializes a checkpoint file that is written by a background thread.
+ * @details Nothing is written until the first call of ckpt_submit. The first snapshot is due `interval` seconds after this call.
+ * @param ckpt Pointer to an uninitialized checkpoint.
+ * @param filename Name of the checkpoint file, `filename`.tmp is used while a snapshot is written.
+ * @param interval Seconds between two snapshots.
+ * @returns `true` on success, `false` if memory ran out or the writer thread could not be started, the checkpoint must not be
+ * destroyed then.
+ * @remark Starts one thread.
+ */
+bool ckpt_init(ckpt_t *ckpt, const char *filename, double interval)
+{
+    size_t length;
+
+    assert(ckpt);
+    assert(filename);
+
+    length = strlen(filename);
+    ckpt->filename = (char *) malloc(length + 1);
+    ckpt->temp_filename = (char *) malloc(length + 5);
+    if((ckpt->filename == NULL) || (ckpt->temp_filename == NULL))
+    {
+        fprintf(stderr, "[checkpoint] Error: could not allocate memory to store file name\n");
+        free(ckpt->filename);
+        free(ckpt->temp_filename);
+        return false;
+    }
+    memcpy(ckpt->filename, filename, length + 1);
+    memcpy(ckpt->temp_filename, filename, length);
+    memcpy(ckpt->temp_filename + length, ".tmp", 5);
+
+    ckpt->interval = interval;
+    clock_gettime(CLOCK_MONOTONIC, &(ckpt->last));
+    ckpt->pending = NULL;
+    ckpt->pending_size = 0;
+    ckpt->pending_capacity = 0;
+    ckpt->writing = NULL;
+    ckpt->writing_capacity = 0;
+    ckpt->has_pending = false;
+    ckpt->busy = false;
+    ckpt->stopping = false;
+    ckpt->failed = false;
+
+    pthread_mutex_init(&(ckpt->lock), NULL);
+    pthread_cond_init(&(ckpt->wake), NULL);
+    pthread_cond_init(&(ckpt->idle), NULL);
+    if(pthread_create(&(ckpt->thread), NULL, ckpt_writer, ckpt) != 0)
+    {
+        fprintf(stderr, "[checkpoint] Error: could not start writer thread\n");
+        pthread_mutex_destroy(&(ckpt->lock));
+        pthread_cond_destroy(&(ckpt->wake));
+        pthread_cond_destroy(&(ckpt->idle));
+        free(ckpt->filename);
+        free(ckpt->temp_filename);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the pending snapshot, stops the writer thread and frees all memory of a checkpoint.
+ * @param ckpt Pointer to an initialized checkpoint.
+ * @remark Blocks until the last snapshot is on disk.
+ */
+void ckpt_destroy(ckpt_t *ckpt)
+{
+    assert(ckpt);
+
+    pthread_mutex_lock(&(ckpt->lock));
+    ckpt->stopping = true;
+    pthread_cond_signal(&(ckpt->wake));
+    pthread_mutex_unlock(&(ckpt->lock));
+    pthread_join(ckpt->thread, NULL);
+
+    pthread_mutex_destroy(&(ckpt->lock));
+    pthread_cond_destroy(&(ckpt->wake));
+    pthread_cond_destroy(&(ckpt->idle));
+    free(ckpt->pending);
+    free(ckpt->writing);
+    free(ckpt->filename);
+    free(ckpt->temp_filename);
+}
+
+/**
+ * @brief Checks whether the next snapshot is due.
+ * @details Returns `true` at most once per interval, the caller is expected to call ckpt_submit afterwards.
+ * @param ckpt Pointer to an initialized checkpoint.
+ * @returns `true` if `interval` seconds passed since the last snapshot.
+ * @remark Reads the clock, callers should not check on every step of their work.
+ */
+bool ckpt_is_due(ckpt_t *ckpt)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if((now.tv_sec - ckpt->last.tv_sec) + (now.tv_nsec - ckpt->last.tv_nsec) / 1e9 < ckpt->interval)
+        return false;
+
+    ckpt->last = now;
+    return true;
+}
+
+/**
+ * @brief Hands a snapshot to the writer thread.
+ * @details Copies `data`, so the caller may change it right away. A snapshot that was not written yet is replaced.
+ * @param ckpt Pointer to an initialized checkpoint.
+ * @param data Snapshot to write.
+ * @param size Number of bytes of the snapshot.
+ * @returns `true` on success, `false` if memory ran out, an older snapshot that was not written yet is kept then.
+ * @remark Takes O(`size`) time and never waits for the disk.
+ */
+bool ckpt_submit(ckpt_t *ckpt, const void *data, uint32_t size)
+{
+    assert(ckpt);
+    assert(data || (size == 0));
+
+    pthread_mutex_lock(&(ckpt->lock));
+    if(size > ckpt->pending_capacity)
+    {
+        uint8_t *pending = (uint8_t *) realloc(ckpt->pending, size);
+        if(pending == NULL)
+        {
+            fprintf(stderr, "[checkpoint] Error: could not allocate memory to store snapshot\n");
+            pthread_mutex_unlock(&(ckpt->lock));
+            return false;
+        }
+        ckpt->pending = pending;
+        ckpt->pending_capacity = size;
+    }
+    memcpy(ckpt->pending, data, size);
+    ckpt->pending_size = size;
+    ckpt->has_pending = true;
+    pthread_cond_signal(&(ckpt->wake));
+    pthread_mutex_unlock(&(ckpt->lock));
+    return true;
+}
+
+/**
+ * @brief Drops the pending snapshot and deletes the checkpoint file.
+ * @details Waits for a snapshot that is being written, so that it cannot recreate the file.
+ * @param ckpt Pointer to an initialized checkpoint.
+ */
+void ckpt_discard(ckpt_t *ckpt)
+{
+    assert(ckpt);
+
+    pthread_mutex_lock(&(ckpt->lock));
+    ckpt->has_pending = false;
+    while(ckpt->busy)
+        pthread_cond_wait(&(ckpt->idle), &(ckpt->lock));
+    pthread_mutex_unlock(&(ckpt->lock));
+
+    remove(ckpt->filename);
+}
+
+/**
+ * @brief Reads a checkpoint file.
+ * @param filename Name of the checkpoint file.
+ * @param data Receives the snapshot, which the caller has to free, or `NULL` if the file could not be read.
+ * @param size Receives the number of bytes of the snapshot.
+ * @returns `true` on success or if the file could not be read, `false` if memory ran out.
+ */
+bool ckpt_load(const char *filename, uint8_t **data, uint32_t *size)
+{
+    FILE *file;
+    long length;
+
+    *data = NULL;
+    file = fopen(filename, "rb");
+    if(file == NULL)
+        return true;
+
+    if((fseek(file, 0, SEEK_END) != 0) || ((length = ftell(file)) < 0) || (length > UINT32_MAX) || (fseek(file, 0, SEEK_SET) != 0))
+    {
+        fclose(file);
+        return true;
+    }
+
+    *data = (uint8_t *) malloc((size_t) length + 1);
+    if(*data == NULL)
+    {
+        fprintf(stderr, "[checkpoint] Error: could not allocate memory to load snapshot\n");
+        fclose(file);
+        return false;
+    }
+
+    if(fread(*data, 1, (size_t) length, file) != (size_t) length)
+    {
+        free(*data);
+        *data = NULL;
+    }
+    fclose(file);
+
+    *size = (uint32_t) length;
+    return true;
+}
@@ -0,0 +1,56 @@
+#ifndef CHECKPOINT_H_INCLUDED
+#define CHECKPOINT_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <pthread.h>
+
+/**
+ * @defgroup Checkpoint Checkpoint
+ * @{
+ */
+
+struct _ckpt_s
+{
+    char *filename;
+    /** @brief Snapshots are written to this file first and renamed, so that `filename` always holds a complete one. */
+    char *temp_filename;
+    /** @brief Seconds between two snapshots, see ckpt_is_due. */
+    double interval;
+    /** @brief Time of CLOCK_MONOTONIC at which the last snapshot was taken. */
+    struct timespec last;
+    /** @brief Writes the snapshots in the background. */
+    pthread_t thread;
+    pthread_mutex_t lock;
+    /** @brief Signals the writer that a snapshot is pending or that it has to stop. */
+    pthread_cond_t wake;
+    /** @brief Signals that the writer finished its current snapshot. */
+    pthread_cond_t idle;
+    /** @brief Latest snapshot that was not written yet, replaced by newer ones. */
+    uint8_t *pending;
+    uint32_t pending_size;
+    uint32_t pending_capacity;
+    /** @brief Snapshot that the writer works on, swapped with `pending` when it starts. */
+    uint8_t *writing;
+    uint32_t writing_capacity;
+    bool has_pending;
+    bool busy;
+    bool stopping;
+    /** @brief A write failed, the error is reported only once. */
+    bool failed;
+};
+typedef struct _ckpt_s ckpt_t;
+
+bool ckpt_init(ckpt_t *ckpt, const char *filename, double interval);
+void ckpt_destroy(ckpt_t *ckpt);
+bool ckpt_is_due(ckpt_t *ckpt);
+bool ckpt_submit(ckpt_t *ckpt, const void *data, uint32_t size);
+void ckpt_discard(ckpt_t *ckpt);
+bool ckpt_load(const char *filename, uint8_t **data, uint32_t *size);
+
+/** @} */
+
+#endif
@@ -1,4 +1,10 @@
+#define _POSIX_C_SOURCE 200809L
 #include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
 #include "graph.h"
 #include "union_find.h"
 
@@ -78,6 +84,150 @@ bool graph_save_binary(const graph_t const *graph, const char *filename)
     return true;
 }
 
+/**
+ * @brief Writes a graph in DIMACS format to a file.
+ * @details Writes every edge once, with the labels of its endpoints. Isolated vertices are counted by the 'problem' line only.
+ * @param graph Graph to write.
+ * @param filename File to write to.
+ * @returns `false` on error, `true` on success.
+ */
+bool graph_save_dimacs(const graph_t const *graph, const char *filename)
+{
+    FILE *fd;
+    bool success;
+
+    if((fd = fopen(filename, "wb")) == NULL)
+    {
+        fprintf(stderr, "Error: could not open graph file for writing (%s)\n", strerror(errno));
+        return false;
+    }
+
+    fprintf(fd, "p edge %u %u\n", graph_num_vertices(graph), graph_num_edges(graph));
+    for(vertex_t u = 0; u < graph_num_vertices(graph); u++)
+    {
+        for(uint32_t i = graph->positions[u]; i < graph->positions[u] + graph_degree(graph, u); i++)
+        {
+            if(u < graph->edges[i])
+                fprintf(fd, "e %u %u\n", graph_get_label(graph, u), graph_get_label(graph, graph->edges[i]));
+        }
+    }
+
+    success = !ferror(fd);
+    return (fclose(fd) == 0) && success;
+}
+
+/**
+ * @brief Writes a vertex cover to a file.
+ * @details Writes the labels of all vertices of the cover, one per line. If `filename` is `-`, the cover is written to stdout.
+ * @param graph Graph the cover belongs to.
+ * @param cover Stack of vertex ids (`vertex_t`) that form the cover.
+ * @param filename File to write to.
+ * @returns `false` on error, `true` on success.
+ */
+bool graph_save_cover(const graph_t const *graph, const stack_t const *cover, const char *filename)
+{
+    FILE *fd = stdout;
+    bool success;
+
+    if(strcmp(filename, "-") && ((fd = fopen(filename, "wb")) == NULL))
+    {
+        fprintf(stderr, "Error: could not open cover file for writing (%s)\n", strerror(errno));
+        return false;
+    }
+
+    fprintf(fd, "c vertex cover of size %u\n", stack_height(cover));
+    for(uint32_t i = 0; i < stack_height(cover); i++)
+    {
+        vertex_t *vertex = (vertex_t *) stack_get_element_ptr(cover, i);
+        fprintf(fd, "%u\n", graph_get_label(graph, *vertex));
+    }
+
+    /* a full disk shows up when the buffer is flushed */
+    success = (fflush(fd) == 0) && !ferror(fd);
+    if(fd != stdout)
+        success = (fclose(fd) == 0) && success;
+    if(!success)
+        fprintf(stderr, "Error: could not write cover file (%s)\n", strerror(errno));
+    return success;
+}
+
+/**
+ * @brief Reads a vertex cover that was written by graph_save_cover.
+ * @param graph Graph the cover belongs to.
+ * @param cover Pointer to an uninitialized bitset that receives the vertex ids of the cover.
+ * @param filename File to read from disk.
+ * @returns `false` on error, `true` on success.
+ */
+bool graph_load_cover(const graph_t const *graph, bitset_t *cover, const char *filename)
+{
+    FILE *fd;
+    char buffer[GRAPH_MAX_INPUT_BUFFER_SIZE];
+    unsigned int label;
+    vertex_t vertex;
+
+    fd = fopen(filename, "rb");
+    if(fd == NULL)
+    {
+        fprintf(stderr, "Error: could not open cover file for reading (%s)\n", strerror(errno));
+        return false;
+    }
+
+    if(!bitset_init(cover, (bitset_index_t) graph_num_vertices(graph)))
+    {
+        fclose(fd);
+        return false;
+    }
+
+    while(fgets(buffer, GRAPH_MAX_INPUT_BUFFER_SIZE, fd))
+    {
+        /* skip comments and empty lines */
+        if((buffer[0] == 'c') || (buffer[0] == '\n') || (buffer[0] == '\r'))
+            continue;
+
+        if((sscanf(buffer, "%u", &label) != 1) || !graph_get_vertex_by_label(graph, label, &vertex))
+        {
+            fprintf(stderr, "Error: cover file contains an unknown vertex\n");
+            bitset_destroy(cover);
+            fclose(fd);
+            return false;
+        }
+
+        bitset_set(cover, (bitset_index_t) vertex);
+    }
+
+    fclose(fd);
+    return true;
+}
+
+/**
+ * @brief Tests whether a set of vertices covers all edges of a graph.
+ * @details Makes a single pass over the adjacency lists: the neighbors of every vertex that is not in the cover need to be in the cover.
+ * @param graph Graph.
+ * @param cover Set of vertex ids.
+ * @returns `true` if every edge has an endpoint in `cover`, `false` otherwise.
+ */
+bool graph_verify_cover(const graph_t const *graph, const bitset_t const *cover)
+{
+    uint32_t end = 0;
+
+    for(vertex_t vertex = 0; vertex < graph_num_vertices(graph); vertex++)
+    {
+        uint32_t position = end;
+
+        end = position + graph_degree(graph, vertex);
+        if(bitset_get(cover, (bitset_index_t) vertex))
+            continue;
+
+        for(; position < end; position++)
+        {
+            if(!bitset_get(cover, (bitset_index_t) graph->edges[position]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 uint32_t graph_num_vertices(const graph_t const *graph)
 {
     return graph->num_vertices;
@@ -136,149 +286,711 @@ void graph_destroy(graph_t *graph)
     graph->num_edges = 0;
 }
 
-void subgraph_init_induced(subgraph_t *subgraph, const graph_t const *base_graph)
+/** @brief Entry of the trail that stands for an edge that was added by subgraph_add_edge. */
+#define SUBGRAPH_TRAIL_EDGE UINT32_MAX
+
+static void subgraph_remove_last_edge(subgraph_t *subgraph);
+
+bool subgraph_init_induced(subgraph_t *subgraph, const graph_t const *base_graph)
 {
+    bool success;
+
     subgraph->base = base_graph;
     subgraph->num_vertices = 0;
-    bitset_init(&(subgraph->vertices), (bitset_index_t) graph_num_vertices(base_graph));
-}
+    subgraph->num_edges = 0;
+    success = bitset_init(&(subgraph->vertices), (bitset_index_t) graph_num_vertices(base_graph));
+    subgraph->buckets = NULL;
+    subgraph->trail = NULL;
+    subgraph->overlay = NULL;
 
-void subgraph_init_copy(subgraph_t *subgraph, const subgraph_t const *source)
-{
-    subgraph->base = source->base;
-    subgraph->num_vertices = source->num_vertices;
-    bitset_init_copy(&(subgraph->vertices), &(source->vertices));
+    /* one more slot, so that graphs without vertices don't cause a zero-sized allocation */
+    subgraph->degrees = (uint32_t *) calloc(graph_num_vertices(base_graph) + 1, sizeof(uint32_t));
+    if(subgraph->degrees == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store vertex degrees\n");
+        return false;
+    }
+    return success;
 }
 
-void subgraph_copy(subgraph_t *subgraph, const subgraph_t const *source)
+/**
+ * @brief Allocates an overlay without edges.
+ * @param subgraph Subgraph without overlay.
+ * @returns `true` on success, `false` if memory ran out, the subgraph has no overlay then.
+ */
+static bool subgraph_overlay_create(subgraph_t *subgraph)
 {
-    subgraph->base = source->base;
-    subgraph->num_vertices = source->num_vertices;
-    bitset_copy(&(subgraph->vertices), &(source->vertices));
+    uint32_t num_vertices = graph_num_vertices(subgraph->base);
+
+    subgraph->overlay = (subgraph_overlay_t *) malloc(sizeof(subgraph_overlay_t));
+    if(subgraph->overlay)
+    {
+        /* one more slot, so that graphs without vertices don't cause a zero-sized allocation */
+        subgraph->overlay->heads = (uint32_t *) malloc(sizeof(uint32_t) * 2 * (num_vertices + 1));
+    }
+    if((subgraph->overlay == NULL) || (subgraph->overlay->heads == NULL))
+    {
+        fprintf(stderr, "Error: could not allocate memory to store merged edges\n");
+        free(subgraph->overlay);
+        subgraph->overlay = NULL;
+        return false;
+    }
+
+    subgraph->overlay->marks = subgraph->overlay->heads + num_vertices + 1;
+    subgraph->overlay->stamp = 0;
+    for(uint32_t i = 0; i <= num_vertices; i++)
+    {
+        subgraph->overlay->heads[i] = SUBGRAPH_NO_EDGE;
+        subgraph->overlay->marks[i] = 0;
+    }
+    return true;
 }
 
-void subgraph_add_vertex(subgraph_t *subgraph, vertex_t vertex)
+/**
+ * @brief Frees the overlay of a subgraph, if it has one.
+ * @param subgraph Initialized subgraph.
+ */
+static void subgraph_overlay_destroy(subgraph_t *subgraph)
 {
-    if(!bitset_get(&(subgraph->vertices), (bitset_index_t) vertex))
-        subgraph->num_vertices++;
+    if(subgraph->overlay == NULL)
+        return;
 
-    bitset_set(&(subgraph->vertices), (bitset_index_t) vertex);
+    stack_destroy(&(subgraph->overlay->edges));
+    free(subgraph->overlay->heads);
+    free(subgraph->overlay);
+    subgraph->overlay = NULL;
 }
 
-void subgraph_remove_vertex(subgraph_t *subgraph, vertex_t vertex)
+/**
+ * @brief Replaces the overlay of a subgraph by a copy of another overlay.
+ * @param subgraph Initialized subgraph.
+ * @param source Subgraph of the same base graph.
+ * @returns `true` on success, `false` if memory ran out, the subgraph has no overlay then.
+ */
+static bool subgraph_overlay_copy(subgraph_t *subgraph, const subgraph_t const *source)
 {
-    if(bitset_get(&(subgraph->vertices), (bitset_index_t) vertex))
-        subgraph->num_vertices--;
+    if(source->overlay == NULL)
+    {
+        subgraph_overlay_destroy(subgraph);
+        return true;
+    }
 
-    bitset_clear(&(subgraph->vertices), (bitset_index_t) vertex);
+    if(subgraph->overlay == NULL)
+    {
+        if(!subgraph_overlay_create(subgraph))
+            return false;
+    }
+    else
+        stack_destroy(&(subgraph->overlay->edges));
+
+    memcpy(subgraph->overlay->heads, source->overlay->heads, sizeof(uint32_t) * graph_num_vertices(source->base));
+    if(!stack_init_copy(&(subgraph->overlay->edges), &(source->overlay->edges)))
+    {
+        subgraph_overlay_destroy(subgraph);
+        return false;
+    }
+    return true;
 }
 
-void subgraph_destroy(subgraph_t *subgraph)
+/**
+ * @brief Replaces the degree buckets of a subgraph by a copy of the buckets of another subgraph.
+ * @param subgraph Initialized subgraph.
+ * @param source Subgraph of the same base graph.
+ * @returns `true` on success, `false` if memory ran out, the subgraph has no buckets then.
+ */
+static bool subgraph_buckets_copy(subgraph_t *subgraph, const subgraph_t const *source)
 {
-    subgraph->base = NULL;
-    bitset_destroy(&(subgraph->vertices));
+    if(subgraph->buckets && ((source->buckets == NULL) || (subgraph->buckets->num_keys != source->buckets->num_keys)))
+        subgraph_disable_buckets(subgraph);
+
+    if(source->buckets == NULL)
+        return true;
+
+    if(subgraph->buckets)
+    {
+        bq_copy(subgraph->buckets, source->buckets);
+        return true;
+    }
+
+    subgraph->buckets = (bq_t *) malloc(sizeof(bq_t));
+    if(subgraph->buckets == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store degree buckets\n");
+        return false;
+    }
+    if(!bq_init_copy(subgraph->buckets, source->buckets))
+    {
+        subgraph_disable_buckets(subgraph);
+        return false;
+    }
+    return true;
 }
 
-bool subgraph_is_connected(const subgraph_t const *subgraph)
+bool subgraph_init_copy(subgraph_t *subgraph, const subgraph_t const *source)
 {
-    uint32_t num_components;
-    uf_t components;
-    subgraph_iter_t iter_vert, iter_neigh;
-    vertex_t vertex, neighbor;
-    
-    num_components = subgraph_num_vertices(subgraph);
-    uf_init(&components, subgraph_base_num_vertices(subgraph));
+    bool success;
 
-    subgraph_iter_all_vertices(subgraph, &iter_vert);
-    while(subgraph_iter_next(subgraph, &iter_vert, &vertex))
+    subgraph->base = source->base;
+    subgraph->num_vertices = source->num_vertices;
+    subgraph->num_edges = source->num_edges;
+    success = bitset_init_copy(&(subgraph->vertices), &(source->vertices));
+    subgraph->trail = NULL;
+    subgraph->buckets = NULL;
+    subgraph->overlay = NULL;
+
+    subgraph->degrees = (uint32_t *) malloc(sizeof(uint32_t) * (graph_num_vertices(source->base) + 1));
+    if(subgraph->degrees == NULL)
     {
-        subgraph_iter_neighborhood(subgraph, &iter_neigh, vertex);
-        while(subgraph_iter_next(subgraph, &iter_neigh, &neighbor))
-        {
-            if(uf_find(&components, vertex) != uf_find(&components, neighbor))
-            {
-                uf_union(&components, vertex, neighbor);
-                num_components--;
-            }
-        }
+        fprintf(stderr, "Error: could not allocate memory to store vertex degrees\n");
+        return false;
     }
-    
-    subgraph_iter_destroy(&iter_vert);
-    
-    uf_destroy(&components);
+    memcpy(subgraph->degrees, source->degrees, sizeof(uint32_t) * graph_num_vertices(source->base));
 
-    fprintf(stdout, "[debug] graph has %u component(s)\n", num_components);
-    return (num_components == 1);
+    return success && subgraph_buckets_copy(subgraph, source) && subgraph_overlay_copy(subgraph, source);
 }
 
-bool subgraph_contains_vertex(const subgraph_t const *subgraph, vertex_t vertex)
+bool subgraph_copy(subgraph_t *subgraph, const subgraph_t const *source)
 {
-    return bitset_get(&(subgraph->vertices), (bitset_index_t) vertex);
+    subgraph->base = source->base;
+    subgraph->num_vertices = source->num_vertices;
+    subgraph->num_edges = source->num_edges;
+    bitset_copy(&(subgraph->vertices), &(source->vertices));
+    memcpy(subgraph->degrees, source->degrees, sizeof(uint32_t) * graph_num_vertices(source->base));
+
+    return subgraph_buckets_copy(subgraph, source) && subgraph_overlay_copy(subgraph, source);
 }
 
-void subgraph_print(const subgraph_t const *subgraph)
+/**
+ * @brief Starts to keep the vertices of a subgraph sorted by degree.
+ * @details Every vertex of the subgraph is put into the bucket of its degree. The buckets are updated whenever vertices are added or removed, so that subgraph_find_max_degree, subgraph_find_min_degree and subgraph_first_of_degree don't need to scan all vertices. Does nothing if the buckets already exist.
+ * @param subgraph Initialized subgraph.
+ * @returns `true` on success, `false` if memory ran out, the subgraph has no buckets then.
+ * @remark Allocates O(`n`) memory, which is also copied by subgraph_init_copy and subgraph_copy.
+ */
+bool subgraph_enable_buckets(subgraph_t *subgraph)
 {
-    subgraph_iter_t iterator;
+    uint32_t num_vertices = graph_num_vertices(subgraph->base);
+    uint32_t max_degree = 0;
     vertex_t vertex;
-    
-    fprintf(stdout, "--- subgraph ---\n");
-    subgraph_iter_all_vertices(subgraph, &iterator);
-    while(subgraph_iter_next(subgraph, &iterator, &vertex))
+
+    if(subgraph->buckets)
+        return true;
+
+    for(vertex = 0; vertex < num_vertices; vertex++)
     {
-        subgraph_iter_t iter_neighborhood;
-        vertex_t neighbor;
-        bool first = true;
-        
-        fprintf(stdout, "[vertex] %u: [", vertex);
-        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
-        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
-        {
-            if(first)
-            {
-                first = false;
-                fprintf(stdout, "%u", neighbor);
-            }
-            else
-                fprintf(stdout, ", %u", neighbor);
-        }
-        subgraph_iter_destroy(&iter_neighborhood);
-        fprintf(stdout, "]\n");
+        if(graph_degree(subgraph->base, vertex) > max_degree)
+            max_degree = graph_degree(subgraph->base, vertex);
     }
-    fprintf(stdout, "---   end   ---\n");
-    subgraph_iter_destroy(&iterator);
+
+    /* merged vertices may have more neighbors than any vertex of the base graph */
+    if(subgraph->overlay && (num_vertices > max_degree))
+        max_degree = num_vertices;
+
+    subgraph->buckets = (bq_t *) malloc(sizeof(bq_t));
+    if(subgraph->buckets == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store degree buckets\n");
+        return false;
+    }
+    if(!bq_init(subgraph->buckets, num_vertices, max_degree + 1))
+    {
+        subgraph_disable_buckets(subgraph);
+        return false;
+    }
+
+    for(vertex = 0; vertex < num_vertices; vertex++)
+    {
+        if(bitset_get(&(subgraph->vertices), (bitset_index_t) vertex))
+            bq_insert(subgraph->buckets, vertex, subgraph->degrees[vertex]);
+    }
+    return true;
 }
 
-uint32_t subgraph_num_vertices(const subgraph_t const *subgraph)
+/**
+ * @brief Starts to record the vertices that are removed from a subgraph.
+ * @details Every vertex that is removed by subgraph_remove_vertex and every edge that is added by subgraph_add_edge is pushed onto the trail, so that a search can undo all changes since a mark by subgraph_trail_rollback instead of working on copies. Vertices that are added are not recorded. Room for removing every vertex once is allocated up front and kept by subgraph_add_edge, so that subgraph_remove_vertex never runs out of memory. Does nothing if the trail already exists.
+ * @param subgraph Initialized subgraph.
+ * @returns `true` on success, `false` if memory ran out, the subgraph has no trail then.
+ * @remark The trail is not copied by subgraph_init_copy and subgraph_copy.
+ */
+bool subgraph_enable_trail(subgraph_t *subgraph)
 {
-    return subgraph->num_vertices;
+    if(subgraph->trail)
+        return true;
+
+    subgraph->trail = (stack_t *) malloc(sizeof(stack_t));
+    if(subgraph->trail == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store removal trail\n");
+        return false;
+    }
+    if(!stack_init(subgraph->trail, sizeof(vertex_t)) || !stack_reserve(subgraph->trail, graph_num_vertices(subgraph->base) + 1))
+    {
+        stack_destroy(subgraph->trail);
+        free(subgraph->trail);
+        subgraph->trail = NULL;
+        return false;
+    }
+    return true;
 }
 
-uint32_t subgraph_base_num_vertices(const subgraph_t const *subgraph)
+/**
+ * @brief Returns the current position of the removal trail.
+ * @param subgraph Subgraph with a trail, see subgraph_enable_trail.
+ * @returns Mark that can be passed to subgraph_trail_rollback.
+ */
+uint32_t subgraph_trail_mark(const subgraph_t const *subgraph)
 {
-    return graph_num_vertices(subgraph->base);
+    return stack_height(subgraph->trail);
 }
 
-const graph_t *subgraph_get_base_graph(const subgraph_t const *subgraph)
+/**
+ * @brief Adds all vertices back that were removed after a mark was taken and drops all edges that were added since.
+ * @details Changes are undone in reverse order.
+ * @param subgraph Subgraph with a trail, see subgraph_enable_trail.
+ * @param mark Mark that was returned by subgraph_trail_mark.
+ */
+void subgraph_trail_rollback(subgraph_t *subgraph, uint32_t mark)
 {
-    return subgraph->base;
+    vertex_t vertex;
+
+    while(stack_height(subgraph->trail) > mark)
+    {
+        stack_pop(subgraph->trail, &vertex);
+        if(vertex == SUBGRAPH_TRAIL_EDGE)
+            subgraph_remove_last_edge(subgraph);
+        else
+            subgraph_add_vertex(subgraph, vertex);
+    }
 }
 
-void subgraph_find_components(const subgraph_t const *subgraph, stack_t *components)
+/**
+ * @brief Stops to keep the vertices of a subgraph sorted by degree and frees the buckets.
+ * @param subgraph Initialized subgraph.
+ */
+void subgraph_disable_buckets(subgraph_t *subgraph)
 {
-    subgraph_t subgraph_current;
-    subgraph_iter_t iter_vertices, iter_neigh;
-    vertex_t vertex, neighbor;
-    stack_t stack_dfs;
-    
-    stack_init(&stack_dfs, sizeof(vertex_t));
-    
-    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    if(subgraph->buckets == NULL)
+        return;
+
+    bq_destroy(subgraph->buckets);
+    free(subgraph->buckets);
+    subgraph->buckets = NULL;
+}
+
+/**
+ * @brief Allows edges to be added to a subgraph that are not part of its base graph.
+ * @details Added edges are kept in adjacency lists on top of the base graph and are visited by subgraph_iter_neighborhood after the edges of the base graph. Degree buckets are rebuilt, since merged vertices may exceed the greatest degree of the base graph. Does nothing if the overlay already exists.
+ * @param subgraph Initialized subgraph.
+ * @returns `true` on success, `false` if memory ran out.
+ * @remark Allocates O(`n`) memory, which is also copied by subgraph_init_copy and subgraph_copy together with all added edges.
+ */
+bool subgraph_enable_overlay(subgraph_t *subgraph)
+{
+    if(subgraph->overlay)
+        return true;
+
+    if(!subgraph_overlay_create(subgraph))
+        return false;
+    if(!stack_init(&(subgraph->overlay->edges), sizeof(subgraph_overlay_edge_t)))
+    {
+        subgraph_overlay_destroy(subgraph);
+        return false;
+    }
+
+    if(subgraph->buckets)
+    {
+        subgraph_disable_buckets(subgraph);
+        return subgraph_enable_buckets(subgraph);
+    }
+    return true;
+}
+
+/**
+ * @brief Tests whether edges can be added to a subgraph.
+ * @param subgraph Initialized subgraph.
+ * @returns `true` if subgraph_enable_overlay was called, `false` otherwise.
+ */
+bool subgraph_has_overlay(const subgraph_t const *subgraph)
+{
+    return (subgraph->overlay != NULL);
+}
+
+/**
+ * @brief Tests whether two vertices of a subgraph are adjacent.
+ * @param subgraph Initialized subgraph.
+ * @param u Vertex of the subgraph.
+ * @param v Vertex of the subgraph.
+ * @returns `true` if `uv` is an edge of the subgraph, `false` otherwise.
+ * @remark Scans the neighborhood of the endpoint of smaller degree.
+ */
+bool subgraph_is_adjacent(const subgraph_t const *subgraph, vertex_t u, vertex_t v)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+
+    if(subgraph->degrees[u] > subgraph->degrees[v])
+    {
+        vertex_t temp = u;
+        u = v;
+        v = temp;
+    }
+
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, u);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+    {
+        if(neighbor == v)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Pushes one direction of an edge onto the overlay.
+ * @param subgraph Subgraph with overlay.
+ * @param from Vertex whose adjacency list receives the edge.
+ * @param to Vertex the edge leads to.
+ */
+static void subgraph_overlay_push(subgraph_t *subgraph, vertex_t from, vertex_t to)
+{
+    subgraph_overlay_edge_t edge;
+
+    edge.target = to;
+    edge.next = subgraph->overlay->heads[from];
+    subgraph->overlay->heads[from] = stack_height(&(subgraph->overlay->edges));
+    stack_push(&(subgraph->overlay->edges), &edge);
+
+    subgraph->degrees[from]++;
+    if(subgraph->buckets)
+        bq_update(subgraph->buckets, from, subgraph->degrees[from]);
+}
+
+/**
+ * @brief Adds an edge between two vertices of a subgraph.
+ * @param subgraph Subgraph with overlay, see subgraph_enable_overlay.
+ * @param u Vertex of the subgraph.
+ * @param v Vertex of the subgraph that is not adjacent to `u`.
+ * @returns `true` on success, `false` if memory ran out, the subgraph is unchanged then.
+ * @remark The edge can only be removed again by subgraph_trail_rollback.
+ */
+bool subgraph_add_edge(subgraph_t *subgraph, vertex_t u, vertex_t v)
+{
+    vertex_t entry = SUBGRAPH_TRAIL_EDGE;
+
+    /* the trail keeps room for removing the remaining vertices */
+    if(!stack_grow(&(subgraph->overlay->edges), 2) || (subgraph->trail && !stack_grow(subgraph->trail, subgraph->num_vertices + 1)))
+        return false;
+
+    subgraph_overlay_push(subgraph, u, v);
+    subgraph_overlay_push(subgraph, v, u);
+    subgraph->num_edges++;
+
+    if(subgraph->trail)
+        stack_push(subgraph->trail, &entry);
+    return true;
+}
+
+/**
+ * @brief Removes the edge that was added last.
+ * @details Both endpoints must be part of the subgraph, which holds whenever changes are undone in reverse order.
+ * @param subgraph Subgraph with overlay.
+ */
+static void subgraph_remove_last_edge(subgraph_t *subgraph)
+{
+    stack_t *edges = &(subgraph->overlay->edges);
+    uint32_t height = stack_height(edges);
+    const subgraph_overlay_edge_t *forward = (const subgraph_overlay_edge_t *) stack_get_element_ptr(edges, height - 2);
+    const subgraph_overlay_edge_t *backward = (const subgraph_overlay_edge_t *) stack_get_element_ptr(edges, height - 1);
+    vertex_t u = backward->target, v = forward->target;
+
+    /* both directions are still the most recent overlay edges of their endpoints */
+    subgraph->overlay->heads[u] = forward->next;
+    subgraph->overlay->heads[v] = backward->next;
+    subgraph->degrees[u]--;
+    subgraph->degrees[v]--;
+    subgraph->num_edges--;
+    if(subgraph->buckets)
+    {
+        bq_update(subgraph->buckets, u, subgraph->degrees[u]);
+        bq_update(subgraph->buckets, v, subgraph->degrees[v]);
+    }
+
+    stack_remove_last(edges);
+    stack_remove_last(edges);
+}
+
+/**
+ * @brief Merges a vertex into another one.
+ * @details `vertex` becomes adjacent to every neighbor of `other`, then `other` is removed. Used to contract vertices, e.g. by the folding rule of vertex cover.
+ * @param subgraph Subgraph with overlay, see subgraph_enable_overlay.
+ * @param vertex Vertex of the subgraph that remains.
+ * @param other Vertex of the subgraph that is merged into `vertex`.
+ * @returns `true` on success, `false` if memory ran out, `other` is only partially merged then but the changes can still be undone by subgraph_trail_rollback.
+ * @remark Costs O(deg(`vertex`) + deg(`other`)), all changes are recorded on the trail.
+ */
+bool subgraph_merge_vertices(subgraph_t *subgraph, vertex_t vertex, vertex_t other)
+{
+    subgraph_overlay_t *overlay = subgraph->overlay;
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+
+    overlay->stamp++;
+    if(overlay->stamp == 0)
+    {
+        /* flags of earlier merges might match again */
+        for(uint32_t i = 0; i < graph_num_vertices(subgraph->base); i++)
+            overlay->marks[i] = 0;
+        overlay->stamp = 1;
+    }
+
+    overlay->marks[vertex] = overlay->stamp;
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        overlay->marks[neighbor] = overlay->stamp;
+
+    /* new edges only extend the lists of 'vertex' and the neighbor, so the walk over 'other' is not affected */
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, other);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+    {
+        if((overlay->marks[neighbor] != overlay->stamp) && !subgraph_add_edge(subgraph, vertex, neighbor))
+            return false;
+    }
+
+    subgraph_remove_vertex(subgraph, other);
+    return true;
+}
+
+void subgraph_add_vertex(subgraph_t *subgraph, vertex_t vertex)
+{
+    uint32_t position, end;
+
+    if(bitset_get(&(subgraph->vertices), (bitset_index_t) vertex))
+        return;
+
+    subgraph->num_vertices++;
+    bitset_set(&(subgraph->vertices), (bitset_index_t) vertex);
+    if(subgraph->buckets)
+        bq_insert(subgraph->buckets, vertex, subgraph->degrees[vertex]);
+
+    /* only the neighbors of 'vertex' change their degree */
+    position = subgraph->base->positions[vertex];
+    end = position + graph_degree(subgraph->base, vertex);
+    for(; position < end; position++)
+    {
+        vertex_t neighbor = subgraph->base->edges[position];
+
+        subgraph->degrees[neighbor]++;
+        if(bitset_get(&(subgraph->vertices), (bitset_index_t) neighbor))
+        {
+            subgraph->num_edges++;
+            if(subgraph->buckets)
+                bq_update(subgraph->buckets, neighbor, subgraph->degrees[neighbor]);
+        }
+    }
+
+    for(position = subgraph->overlay ? subgraph->overlay->heads[vertex] : SUBGRAPH_NO_EDGE; position != SUBGRAPH_NO_EDGE; )
+    {
+        subgraph_overlay_edge_t *edge = (subgraph_overlay_edge_t *) stack_get_element_ptr(&(subgraph->overlay->edges), position);
+
+        subgraph->degrees[edge->target]++;
+        if(bitset_get(&(subgraph->vertices), (bitset_index_t) edge->target))
+        {
+            subgraph->num_edges++;
+            if(subgraph->buckets)
+                bq_update(subgraph->buckets, edge->target, subgraph->degrees[edge->target]);
+        }
+        position = edge->next;
+    }
+}
+
+void subgraph_remove_vertex(subgraph_t *subgraph, vertex_t vertex)
+{
+    uint32_t position, end;
+
+    if(!bitset_get(&(subgraph->vertices), (bitset_index_t) vertex))
+        return;
+
+    subgraph->num_vertices--;
+    bitset_clear(&(subgraph->vertices), (bitset_index_t) vertex);
+    if(subgraph->buckets)
+        bq_remove(subgraph->buckets, vertex);
+    if(subgraph->trail)
+        stack_push(subgraph->trail, &vertex);
+
+    /* only the neighbors of 'vertex' change their degree */
+    position = subgraph->base->positions[vertex];
+    end = position + graph_degree(subgraph->base, vertex);
+    for(; position < end; position++)
+    {
+        vertex_t neighbor = subgraph->base->edges[position];
+
+        subgraph->degrees[neighbor]--;
+        if(bitset_get(&(subgraph->vertices), (bitset_index_t) neighbor))
+        {
+            subgraph->num_edges--;
+            if(subgraph->buckets)
+                bq_update(subgraph->buckets, neighbor, subgraph->degrees[neighbor]);
+        }
+    }
+
+    for(position = subgraph->overlay ? subgraph->overlay->heads[vertex] : SUBGRAPH_NO_EDGE; position != SUBGRAPH_NO_EDGE; )
+    {
+        subgraph_overlay_edge_t *edge = (subgraph_overlay_edge_t *) stack_get_element_ptr(&(subgraph->overlay->edges), position);
+
+        subgraph->degrees[edge->target]--;
+        if(bitset_get(&(subgraph->vertices), (bitset_index_t) edge->target))
+        {
+            subgraph->num_edges--;
+            if(subgraph->buckets)
+                bq_update(subgraph->buckets, edge->target, subgraph->degrees[edge->target]);
+        }
+        position = edge->next;
+    }
+}
+
+void subgraph_destroy(subgraph_t *subgraph)
+{
+    subgraph->base = NULL;
+    bitset_destroy(&(subgraph->vertices));
+
+    if(subgraph->degrees)
+        free(subgraph->degrees);
+    subgraph->degrees = NULL;
+
+    subgraph_disable_buckets(subgraph);
+
+    if(subgraph->trail)
+    {
+        stack_destroy(subgraph->trail);
+        free(subgraph->trail);
+    }
+    subgraph->trail = NULL;
+
+    subgraph_overlay_destroy(subgraph);
+}
+
+bool subgraph_is_connected(const subgraph_t const *subgraph)
+{
+    uint32_t num_components;
+    uf_t components;
+    subgraph_iter_t iter_vert, iter_neigh;
+    vertex_t vertex, neighbor;
+    
+    num_components = subgraph_num_vertices(subgraph);
+    if(!uf_init(&components, subgraph_base_num_vertices(subgraph)))
+    {
+        uf_destroy(&components);
+        return false;
+    }
+
+    subgraph_iter_all_vertices(subgraph, &iter_vert);
+    while(subgraph_iter_next(subgraph, &iter_vert, &vertex))
+    {
+        subgraph_iter_neighborhood(subgraph, &iter_neigh, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neigh, &neighbor))
+        {
+            if(uf_find(&components, vertex) != uf_find(&components, neighbor))
+            {
+                uf_union(&components, vertex, neighbor);
+                num_components--;
+            }
+        }
+    }
+    
+    subgraph_iter_destroy(&iter_vert);
+    
+    uf_destroy(&components);
+
+    fprintf(stdout, "[debug] graph has %u component(s)\n", num_components);
+    return (num_components == 1);
+}
+
+bool subgraph_contains_vertex(const subgraph_t const *subgraph, vertex_t vertex)
+{
+    return bitset_get(&(subgraph->vertices), (bitset_index_t) vertex);
+}
+
+void subgraph_print(const subgraph_t const *subgraph)
+{
+    subgraph_iter_t iterator;
+    vertex_t vertex;
+    
+    fprintf(stdout, "--- subgraph ---\n");
+    subgraph_iter_all_vertices(subgraph, &iterator);
+    while(subgraph_iter_next(subgraph, &iterator, &vertex))
+    {
+        subgraph_iter_t iter_neighborhood;
+        vertex_t neighbor;
+        bool first = true;
+        
+        fprintf(stdout, "[vertex] %u: [", vertex);
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if(first)
+            {
+                first = false;
+                fprintf(stdout, "%u", neighbor);
+            }
+            else
+                fprintf(stdout, ", %u", neighbor);
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+        fprintf(stdout, "]\n");
+    }
+    fprintf(stdout, "---   end   ---\n");
+    subgraph_iter_destroy(&iterator);
+}
+
+uint32_t subgraph_num_vertices(const subgraph_t const *subgraph)
+{
+    return subgraph->num_vertices;
+}
+
+uint32_t subgraph_num_edges(const subgraph_t const *subgraph)
+{
+    return subgraph->num_edges;
+}
+
+uint32_t subgraph_base_num_vertices(const subgraph_t const *subgraph)
+{
+    return graph_num_vertices(subgraph->base);
+}
+
+const graph_t *subgraph_get_base_graph(const subgraph_t const *subgraph)
+{
+    return subgraph->base;
+}
+
+bool subgraph_find_components(const subgraph_t const *subgraph, stack_t *components)
+{
+    bool success = true;
+    subgraph_t subgraph_current;
+    subgraph_iter_t iter_vertices, iter_neigh;
+    vertex_t vertex, neighbor;
+    stack_t stack_dfs;
+    
+    stack_init(&stack_dfs, sizeof(vertex_t));
+    
+    /* visited vertices are removed from the iterator, which needs its own copy of the vertices */
+    if(!subgraph_iter_all_vertices(subgraph, &iter_vertices))
+    {
+        subgraph_iter_destroy(&iter_vertices);
+        stack_destroy(&stack_dfs);
+        return false;
+    }
     while(subgraph_iter_next(subgraph, &iter_vertices, &vertex))
     {
-        subgraph_init_induced(&subgraph_current, subgraph_get_base_graph(subgraph));
-        stack_push(&stack_dfs, &vertex);
+        if(!subgraph_init_induced(&subgraph_current, subgraph_get_base_graph(subgraph)))
+        {
+            subgraph_destroy(&subgraph_current);
+            success = false;
+            break;
+        }
+        success = stack_push(&stack_dfs, &vertex);
         
-        while(stack_pop(&stack_dfs, &vertex))
+        while(success && stack_pop(&stack_dfs, &vertex))
         {
             subgraph_add_vertex(&subgraph_current, vertex);
             
@@ -288,47 +1000,124 @@ void subgraph_find_components(const subgraph_t const *subgraph, stack_t *compone
                 if(subgraph_iter_contains_vertex(&iter_vertices, neighbor))
                 {
                     subgraph_iter_remove_vertex(&iter_vertices, neighbor);
-                    stack_push(&stack_dfs, &neighbor);
+                    success = stack_push(&stack_dfs, &neighbor) && success;
                 }
             }
             subgraph_iter_destroy(&iter_neigh);
         }
         
-        stack_push(components, &subgraph_current);
+        /* a component that misses vertices is not kept */
+        if(!success || !stack_push(components, &subgraph_current))
+        {
+            subgraph_destroy(&subgraph_current);
+            success = false;
+            break;
+        }
     }
     
     subgraph_iter_destroy(&iter_vertices);
     stack_destroy(&stack_dfs);
+    return success;
 }
 
 uint32_t subgraph_degree(const subgraph_t const *subgraph, vertex_t vertex)
 {
-    subgraph_iter_t iter_neighborhood;
-    uint32_t degree = 0;
-    vertex_t neighbor;
-
-    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
-    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
-        degree++;
-
-    subgraph_iter_destroy(&iter_neighborhood);
-    return degree;
+    return subgraph->degrees[vertex];
 }
 
-void subgraph_iter_init_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator)
+/**
+ * @brief Finds a vertex of maximum degree.
+ * @param subgraph Subgraph with degree buckets, see subgraph_enable_buckets.
+ * @param vertex Address to store the vertex at.
+ * @param degree Address to store the degree of the vertex at.
+ * @returns `true` if a vertex was found, `false` if the subgraph is empty.
+ * @remark Costs amortised O(1).
+ */
+bool subgraph_find_max_degree(const subgraph_t const *subgraph, vertex_t *vertex, uint32_t *degree)
 {
-    iterator->type = GRAPH_ITER_ALL_VERTICES;
-    iterator->last_vertex = 0;
-    iterator->next_vertex = 0;
-    bitset_init(&(iterator->vertices), (bitset_index_t) graph_num_vertices(subgraph->base));
+    return bq_find_max(subgraph->buckets, vertex, degree);
 }
 
-void subgraph_iter_all_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator)
+/**
+ * @brief Finds a vertex of minimum degree.
+ * @param subgraph Subgraph with degree buckets, see subgraph_enable_buckets.
+ * @param vertex Address to store the vertex at.
+ * @param degree Address to store the degree of the vertex at.
+ * @returns `true` if a vertex was found, `false` if the subgraph is empty.
+ * @remark Costs amortised O(1).
+ */
+bool subgraph_find_min_degree(const subgraph_t const *subgraph, vertex_t *vertex, uint32_t *degree)
+{
+    return bq_find_min(subgraph->buckets, vertex, degree);
+}
+
+/**
+ * @brief Returns some vertex of the given degree.
+ * @param subgraph Subgraph with degree buckets, see subgraph_enable_buckets.
+ * @param degree Degree.
+ * @param vertex Address to store the vertex at.
+ * @returns `true` if a vertex was found, `false` if there is no vertex of degree `degree`.
+ * @remark Use subgraph_next_of_degree to visit the other vertices of the same degree. Adding or removing vertices ends such a walk.
+ */
+bool subgraph_first_of_degree(const subgraph_t const *subgraph, uint32_t degree, vertex_t *vertex)
+{
+    *vertex = bq_first(subgraph->buckets, degree);
+    return (*vertex != BQ_NONE);
+}
+
+/**
+ * @brief Returns the next vertex of the same degree.
+ * @param subgraph Subgraph with degree buckets, see subgraph_enable_buckets.
+ * @param vertex Vertex that was returned by subgraph_first_of_degree or subgraph_next_of_degree, is replaced by its successor.
+ * @returns `true` if a vertex was found, `false` if all vertices of that degree were visited.
+ */
+bool subgraph_next_of_degree(const subgraph_t const *subgraph, vertex_t *vertex)
+{
+    *vertex = bq_next(subgraph->buckets, *vertex);
+    return (*vertex != BQ_NONE);
+}
+
+/**
+ * @brief Tests whether a subgraph keeps its vertices sorted by degree.
+ * @param subgraph Initialized subgraph.
+ * @returns `true` if subgraph_enable_buckets was called, `false` otherwise.
+ */
+bool subgraph_has_buckets(const subgraph_t const *subgraph)
+{
+    return (subgraph->buckets != NULL);
+}
+
+/**
+ * @brief Initializes an iterator over a set of vertices that is empty until subgraph_iter_add_vertex is called.
+ * @param subgraph Initialized subgraph.
+ * @param iterator Uninitialized iterator.
+ * @returns `true` on success, `false` if memory ran out, the iterator must only be destroyed then.
+ */
+bool subgraph_iter_init_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator)
 {
     iterator->type = GRAPH_ITER_ALL_VERTICES;
     iterator->last_vertex = 0;
     iterator->next_vertex = 0;
-    bitset_init_copy(&(iterator->vertices), &(subgraph->vertices));
+    return bitset_init(&(iterator->vertices), (bitset_index_t) graph_num_vertices(subgraph->base));
+}
+
+/**
+ * @brief Initializes an iterator over the vertices of a subgraph.
+ * @details The iterator visits a copy of the vertices, so vertices may be removed from the subgraph while iterating.
+ * @param subgraph Initialized subgraph.
+ * @param iterator Uninitialized iterator.
+ * @returns `true` on success, `false` if memory ran out for the copy. The iterator then scans the vertices of the subgraph itself: it still visits every vertex as long as only the visited vertex is removed, but skips vertices that are removed before they are reached and cannot be changed by subgraph_iter_remove_vertex.
+ */
+bool subgraph_iter_all_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator)
+{
+    iterator->type = GRAPH_ITER_ALL_VERTICES;
+    iterator->last_vertex = 0;
+    iterator->next_vertex = 0;
+    if(bitset_init_copy(&(iterator->vertices), &(subgraph->vertices)))
+        return true;
+
+    iterator->type = GRAPH_ITER_SCAN_VERTICES;
+    return false;
 }
 
 void subgraph_iter_neighborhood(const subgraph_t const *subgraph, subgraph_iter_t *iterator, vertex_t vertex)
@@ -336,545 +1125,1346 @@ void subgraph_iter_neighborhood(const subgraph_t const *subgraph, subgraph_iter_
     iterator->type = GRAPH_ITER_NEIGHBORHOOD;
     iterator->edge_start = subgraph->base->positions[vertex];
     iterator->edge_end = iterator->edge_start + graph_degree(subgraph->base, vertex);
+    iterator->overlay_edge = subgraph->overlay ? subgraph->overlay->heads[vertex] : SUBGRAPH_NO_EDGE;
+}
+
+bool subgraph_iter_next(const subgraph_t const *subgraph, subgraph_iter_t *iterator, vertex_t *vertex)
+{
+    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
+    {
+        if(bitset_iterate_set_and_clear(&(iterator->vertices), &(iterator->next_vertex), &(iterator->last_vertex)))
+        {
+            *vertex = (vertex_t) iterator->next_vertex;
+            return true;
+        }
+        
+        return false;
+    }
+    else if(iterator->type == GRAPH_ITER_SCAN_VERTICES)
+    {
+        while(iterator->next_vertex < graph_num_vertices(subgraph->base))
+        {
+            *vertex = (vertex_t) iterator->next_vertex;
+            iterator->next_vertex++;
+            if(subgraph_contains_vertex(subgraph, *vertex))
+                return true;
+        }
+
+        return false;
+    }
+    else
+    {
+        while(iterator->edge_start < iterator->edge_end)
+        {
+            vertex_t neighbor = graph_get_edge(subgraph->base, iterator->edge_start);
+            iterator->edge_start++;
+            
+            if(subgraph_contains_vertex(subgraph, neighbor))
+            {
+                *vertex = neighbor;
+                return true;
+            }
+        }
+
+        while(iterator->overlay_edge != SUBGRAPH_NO_EDGE)
+        {
+            const subgraph_overlay_edge_t *edge = (const subgraph_overlay_edge_t *) stack_get_element_ptr(&(subgraph->overlay->edges), iterator->overlay_edge);
+            iterator->overlay_edge = edge->next;
+
+            if(subgraph_contains_vertex(subgraph, edge->target))
+            {
+                *vertex = edge->target;
+                return true;
+            }
+        }
+        
+        return false;
+    }
+}
+
+void subgraph_iter_add_vertex(subgraph_iter_t *iterator, vertex_t vertex)
+{
+    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
+    {
+        bitset_set(&(iterator->vertices), vertex);
+        if(iterator->last_vertex > vertex)
+            iterator->last_vertex = vertex;
+    }
+}
+
+void subgraph_iter_remove_vertex(subgraph_iter_t *iterator, vertex_t vertex)
+{
+    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
+        bitset_clear(&(iterator->vertices), vertex);
+}
+
+bool subgraph_iter_contains_vertex(subgraph_iter_t *iterator, vertex_t vertex)
+{
+    if(iterator->type != GRAPH_ITER_ALL_VERTICES)
+        return false;
+    else
+        return bitset_get(&(iterator->vertices), vertex);
+}
+
+void subgraph_iter_destroy(subgraph_iter_t *iterator)
+{
+    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
+        bitset_destroy(&(iterator->vertices));
+}
+
+/**
+ * @brief Compares two vertex labels.
+ * @param a First label.
+ * @param b second label.
+ * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
+ */
+int graph_cmp_vertex_labels(const void *a, const void *b)
+{
+    const vertex_label_t *f = (const vertex_label_t *) a;
+    const vertex_label_t *g = (const vertex_label_t *) b;
+    
+    if(*f < *g)
+        return -1;
+    else if(*f > *g)
+        return 1;
+    else
+        return 0;
+}
+
+/**
+ * @brief Compares two vertex ids.
+ * @param a First label.
+ * @param b second label.
+ * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
+ */
+int graph_cmp_vertices(const void *a, const void *b)
+{
+    const vertex_t *f = (const vertex_t *) a;
+    const vertex_t *g = (const vertex_t *) b;
+    
+    if(*f < *g)
+        return -1;
+    else if(*f > *g)
+        return 1;
+    else
+        return 0;
+}
+
+/**
+ * @brief Compares two edges.
+ * @param a First edge.
+ * @param b second edge.
+ * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
+ */
+int graph_cmp_edges(const void *a, const void *b)
+{
+    const edge_t *f = (const edge_t *) a;
+    const edge_t *g = (const edge_t *) b;
+    
+    if(f->from < g->from)
+        return -1;
+    else if(f->from > g->from)
+        return 1;
+    else if(f->to < g->to)
+        return -1;
+    else if(f->to > g->to)
+        return 1;
+    else
+        return 0;
+}
+
+/**
+ * @brief Initializes a graph builder structure.
+ * @param builder Pointer to uninitialized builder structure.
+ */
+void gbuild_init(gbuild_t *builder)
+{
+    builder->max_vertex_label = 0;
+    builder->sorted = false;
+    stack_init(&(builder->vertex_labels), sizeof(vertex_label_t));
+    stack_init(&(builder->edges), sizeof(edge_t));
+}
+
+/**
+ * @brief Destroys a graph builder.
+ * @details Releases all memory that was allocated.
+ * @param builder Builder to destroy.
+ */
+void gbuild_destroy(gbuild_t *builder)
+{
+    stack_destroy(&(builder->vertex_labels));
+    stack_destroy(&(builder->edges));
+}
+
+/**
+ * @brief Adds a vertex to a graph builder.
+ * @param builder Pointer to initialized builder structure.
+ * @param vertex_label Label of the vertex to be added.
+ * @returns `true` on success, `false` if memory ran out, the builder is unchanged then.
+ */
+bool gbuild_add_vertex(gbuild_t *builder, vertex_label_t vertex_label)
+{
+    /* check if vertex was added before, only add if not already contained in list */
+    if(!stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &vertex_label, NULL))
+    {
+        /* vertex_label is not in list yet, so add it and resort the list */
+        if(!stack_push(&(builder->vertex_labels), &vertex_label))
+            return false;
+        stack_sort(&(builder->vertex_labels), graph_cmp_vertex_labels);
+    }
+    
+    if(vertex_label > builder->max_vertex_label)
+        builder->max_vertex_label = vertex_label;
+    return true;
+}
+
+/**
+ * @brief Adds an edge to a graph builder.
+ * @param builder Pointer to an initialized builder structure.
+ * @param from Vertex label of the first endpoint of the edge.
+ * @param to Vertex label of the second endpoint of the edge.
+ * @returns `true` on success, `false` if memory ran out, the builder is unchanged then.
+ */
+bool gbuild_add_edge(gbuild_t *builder, vertex_label_t from, vertex_label_t to)
+{
+    bool add_from, add_to;
+    edge_t edge;
+    
+    if(from > to)
+    {
+        vertex_label_t tmp = from;
+        from = to;
+        to = tmp;
+    }
+    
+    add_from = !stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &from, NULL);
+    add_to = !stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &to, NULL);
+    
+    /* reserve all room first, so that a failure leaves the builder as it was */
+    if(!stack_grow(&(builder->vertex_labels), 2) || !stack_grow(&(builder->edges), 1))
+        return false;
+    
+    if(add_from)
+        stack_push(&(builder->vertex_labels), &from);
+    
+    if(add_to)
+        stack_push(&(builder->vertex_labels), &to);
+    
+    if(add_from || add_to)
+        stack_sort(&(builder->vertex_labels), graph_cmp_vertex_labels);
+
+    edge.from = from;
+    edge.to = to;
+        
+    stack_push(&(builder->edges), &edge);
+    builder->sorted = false;
+    return true;
+}
+
+/**
+ * @brief Returns the number of distince vertices that were added to the builder.
+ * @param builder Pointer to an initialized builder structure.
+ * @returns Number of distinct vertices.
+ */
+uint32_t gbuild_num_vertices(gbuild_t *builder)
+{
+    return stack_height(&(builder->vertex_labels));
+}
+
+/**
+ * @brief Returns the number of edges that were added to the builder.
+ * @param builder Pointer to an initialized builder structure.
+ * @returns Number of edges that were added.
+ */
+uint32_t gbuild_num_edges(gbuild_t *builder)
+{
+    return stack_height(&(builder->edges));
+}
+
+/**
+ * @brief Tests whether the builder has no edges.
+ * @param builder Pointer to an initialized builder structure.
+ * @returns `true` if the builder does not contain any edges, `false` otherwise.
+ */
+bool gbuild_is_trivial(gbuild_t *builder)
+{
+    return (stack_height(&(builder->edges)) == 0);
+}
+
+/**
+ * @brief Finds the vertex id of a vertex given its label.
+ * @param builder Pointer to an initialized builder structure.
+ * @param vertex_label Vertex label to find the vertex id for.
+ * @param result Address to store the vertex id.
+ * @remark Vertex labels may change if new vertices are added later on.
+ * @returns `true` if the vertex label was found, `false` otherwise.
+ */
+bool gbuild_get_vertex_by_label(gbuild_t *builder, const vertex_label_t vertex_label, vertex_t *result)
+{
+    uint32_t position;
+    bool found = false;
+    
+    found = stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &vertex_label, &position);
+    if(found)
+        *result = position;
+    
+    return found;
 }
 
-bool subgraph_iter_next(const subgraph_t const *subgraph, subgraph_iter_t *iterator, vertex_t *vertex)
-{
-    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
+/**
+ * @brief Creates a simple, undirected graph from a builder structure.
+ * @param builder Pointer to an initialized builder structure.
+ * @param graph Pointer to an uninitialized graph structure.
+ * @returns `false` if memory could not be allocated, the graph is empty then, `true` on success.
+ */
+bool gbuild_create_graph(gbuild_t *builder, graph_t *graph)
+{
+    uint32_t num_vertices = 0, num_edges = 0, num_builder_edges = 0, pos;
+    uint32_t *vertex_degrees, i;
+    vertex_t vert_from;
+    edge_t *edge_iter;
+    
+    graph->num_vertices = 0;
+    graph->num_edges = 0;
+    graph->labels = NULL;
+    graph->positions = NULL;
+    graph->edges = NULL;
+    
+    num_vertices = gbuild_num_vertices(builder);
+    if(num_vertices == 0)
+        return true;
+    else
+        graph->num_vertices = num_vertices;
+        
+    graph->labels = (vertex_label_t *) malloc(sizeof(vertex_label_t) * num_vertices);
+    if(graph->labels == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store vertex labels\n");
+        graph_destroy(graph);
+        return false;
+    }
+    
+    memcpy(graph->labels, builder->vertex_labels.data, sizeof(vertex_label_t) * num_vertices);
+    
+    /* if graph is trivial, we have isolated vertices and then store no edges at all */
+    if(gbuild_is_trivial(builder))
+    {
+        graph->num_edges = 0;
+        graph->positions = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
+        if(graph->positions == NULL)
+        {
+            fprintf(stderr, "Error: could not allocate memory to store edge positions\n");
+            graph_destroy(graph);
+            return false;
+        }
+        
+        /* no edges => all positions = 0 */
+        for(i = 0; i < num_vertices; i++)
+            graph->positions[i] = 0;
+            
+        return true;
+    }
+    
+    /* count vertex degrees, use auxiliary array, size is O(n) */
+    vertex_degrees = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
+    if(vertex_degrees == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store vertex degrees\n");
+        graph_destroy(graph);
+        return false;
+    }
+    
+    /* set all degrees to zero */
+    for(i = 0; i < num_vertices; i++)
+        vertex_degrees[i] = 0;
+    
+    /* sort edge list, so we can iterate and skip duplicates */
+    if(!builder->sorted)
+        stack_sort(&(builder->edges), graph_cmp_edges);
+    num_builder_edges = gbuild_num_edges(builder);
+    
+    edge_iter = (edge_t *) builder->edges.data;
+    num_edges = 0;
+    
+    vert_from = 0;
+    for(i = 0; i < num_builder_edges; i++, edge_iter++)
+    {
+        vertex_t vert_to = 0;
+        
+        /* skip duplicates */
+        if((i > 0) && (graph_cmp_edges(edge_iter - 1, edge_iter) == 0))
+            continue;
+        
+        /* we assume all vertex_labels can be found in the list, NO ERROR CHECKING; edges are sorted, so the first endpoint
+         * only moves forward */
+        while(graph->labels[vert_from] < edge_iter->from)
+            vert_from++;
+        graph_get_vertex_by_label(graph, edge_iter->to, &vert_to);
+        
+        /* increase degree count of edge endpoints */
+        vertex_degrees[vert_from]++;
+        vertex_degrees[vert_to]++;
+        num_edges++;
+    }
+    
+    graph->num_edges = num_edges;
+    
+    /* allocate memory */
+    graph->positions = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
+    if(graph->positions == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store edge positions\n");
+        free(vertex_degrees);
+        graph_destroy(graph);
+        return false;
+    }
+    
+    graph->positions[0] = 0;
+    pos = vertex_degrees[0];
+    for(i = 1; i < num_vertices; i++)
+    {
+        graph->positions[i] = pos;
+        pos = pos + vertex_degrees[i];
+    }
+    
+    graph->edges = (vertex_t *) malloc(sizeof(vertex_t) * 2 * num_edges);
+    if(graph->edges == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store edges\n");
+        free(vertex_degrees);
+        graph_destroy(graph);
+        return false;
+    }
+    
+    /* go through edge list, insert edges into edge list */
+    edge_iter = (edge_t *) builder->edges.data;
+    
+    vert_from = 0;
+    for(i = 0; i < num_builder_edges; i++, edge_iter++)
+    {
+        vertex_t vert_to = 0;
+        
+        /* skip duplicates */
+        if((i > 0) && (graph_cmp_edges(edge_iter - 1, edge_iter) == 0))
+            continue;
+        
+        /* we assume all vertex_labels can be found in the list, NO ERROR CHECKING; edges are sorted, so the first endpoint
+         * only moves forward */
+        while(graph->labels[vert_from] < edge_iter->from)
+            vert_from++;
+        graph_get_vertex_by_label(graph, edge_iter->to, &vert_to);
+        
+        graph->edges[graph->positions[vert_from]] = vert_to;
+        graph->edges[graph->positions[vert_to]] = vert_from;
+        graph->positions[vert_from]++;
+        graph->positions[vert_to]++;
+    }
+    
+    for(i = 0; i < num_vertices; i++)
+        graph->positions[i] = graph->positions[i] - vertex_degrees[i];
+    
+    free(vertex_degrees);
+    return true;
+}
+
+/**
+ * @brief Finds the id of a vertex given its label.
+ * @param graph Graph.
+ * @param vertex_label Label to which the vertex id needs to be found.
+ * @param result Address to store the vertex id.
+ * @returns `true` if the vertex id could be found, `false` otherwise.
+ */
+bool graph_get_vertex_by_label(const graph_t const *graph, const vertex_label_t vertex_label, vertex_t *result)
+{
+    uint32_t l, m, r;
+    int res;
+    
+    l = 0;
+    r = graph->num_vertices;
+    
+    while(l < r)
+    {
+        m = (l + r) / 2;
+        res = graph_cmp_vertex_labels(&(graph->labels[m]), &vertex_label);
+        
+        if(res < 0)
+            l = m + 1;
+        else if(res > 0)
+            r = m;
+        else
+        {
+            if(result)
+                *result = m;
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+/** @brief Contents of an input file, either mapped into memory or read into a buffer. */
+struct _graph_input_s
+{
+    /** @brief First byte of the file, not terminated by a null byte. */
+    const char *data;
+    /** @brief Number of bytes of the file. */
+    size_t size;
+    /** @brief `true` if `data` was mapped with mmap, `false` if it was allocated with malloc. */
+    bool mapped;
+};
+typedef struct _graph_input_s graph_input_t;
+
+/**
+ * @brief Makes the contents of a file available in memory.
+ * @details Regular files are mapped read-only, anything else (pipes, character devices) is read into a buffer.
+ * @param input Pointer to an uninitialized input structure.
+ * @param filename File to read from disk.
+ * @returns `false` on error, `true` on success.
+ */
+static bool graph_input_open(graph_input_t *input, const char *filename)
+{
+    struct stat info;
+    char *buffer = NULL;
+    size_t allocated = 0;
+    ssize_t bytes;
+    int fd;
+
+    input->data = NULL;
+    input->size = 0;
+    input->mapped = false;
+
+    fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        fprintf(stderr, "Error: could not open input file for reading (%s)\n", strerror(errno));
+        return false;
+    }
+
+    if(fstat(fd, &info) != 0)
+    {
+        fprintf(stderr, "Error: could not open input file for reading (%s)\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    if(S_ISREG(info.st_mode))
     {
-        if(bitset_iterate_set_and_clear(&(iterator->vertices), &(iterator->next_vertex), &(iterator->last_vertex)))
+        void *data;
+
+        /* an empty file cannot be mapped, it is an empty input */
+        if(info.st_size == 0)
         {
-            *vertex = (vertex_t) iterator->next_vertex;
+            close(fd);
+            return true;
+        }
+
+        data = mmap(NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(data != MAP_FAILED)
+        {
+            posix_madvise(data, (size_t) info.st_size, POSIX_MADV_SEQUENTIAL);
+            close(fd);
+            input->data = (const char *) data;
+            input->size = (size_t) info.st_size;
+            input->mapped = true;
             return true;
         }
-        
-        return false;
     }
-    else
+
+    /* not mappable, read everything into a growing buffer */
+    for(;;)
     {
-        while(iterator->edge_start < iterator->edge_end)
+        if(input->size == allocated)
         {
-            vertex_t neighbor = graph_get_edge(subgraph->base, iterator->edge_start);
-            iterator->edge_start++;
-            
-            if(subgraph_contains_vertex(subgraph, neighbor))
+            char *new_buffer;
+
+            allocated = (allocated == 0) ? 65536 : 2 * allocated;
+            new_buffer = (char *) realloc(buffer, allocated);
+            if(new_buffer == NULL)
             {
-                *vertex = neighbor;
-                return true;
+                fprintf(stderr, "Error: could not allocate memory to read input file\n");
+                free(buffer);
+                close(fd);
+                return false;
             }
+            buffer = new_buffer;
         }
-        
-        return false;
-    }
-}
 
-void subgraph_iter_add_vertex(subgraph_iter_t *iterator, vertex_t vertex)
-{
-    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
-    {
-        bitset_set(&(iterator->vertices), vertex);
-        if(iterator->last_vertex > vertex)
-            iterator->last_vertex = vertex;
+        bytes = read(fd, buffer + input->size, allocated - input->size);
+        if(bytes == 0)
+            break;
+        else if(bytes < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            fprintf(stderr, "Error: could not read input file (%s)\n", strerror(errno));
+            free(buffer);
+            close(fd);
+            return false;
+        }
+        input->size += (size_t) bytes;
     }
-}
 
-void subgraph_iter_remove_vertex(subgraph_iter_t *iterator, vertex_t vertex)
-{
-    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
-        bitset_clear(&(iterator->vertices), vertex);
+    close(fd);
+    input->data = buffer;
+    return true;
 }
 
-bool subgraph_iter_contains_vertex(subgraph_iter_t *iterator, vertex_t vertex)
+/**
+ * @brief Releases the contents of a file that was opened by graph_input_open.
+ * @param input Input structure.
+ */
+static void graph_input_close(graph_input_t *input)
 {
-    if(iterator->type == GRAPH_ITER_NEIGHBORHOOD)
-        return false;
+    if(input->mapped)
+        munmap((void *) input->data, input->size);
     else
-        return bitset_get(&(iterator->vertices), vertex);
-}
+        free((void *) input->data);
 
-void subgraph_iter_destroy(subgraph_iter_t *iterator)
-{
-    if(iterator->type == GRAPH_ITER_ALL_VERTICES)
-        bitset_destroy(&(iterator->vertices));
+    input->data = NULL;
+    input->size = 0;
+    input->mapped = false;
 }
 
 /**
- * @brief Compares two vertex labels.
- * @param a First label.
- * @param b second label.
- * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
+ * @brief Skips blanks of a line.
+ * @param cursor Current position inside the line.
+ * @param end End of the line.
+ * @returns First position at or after `cursor` that is not a blank.
  */
-int graph_cmp_vertex_labels(const void *a, const void *b)
+static inline const char *graph_skip_blanks(const char *cursor, const char *end)
 {
-    const vertex_label_t *f = (const vertex_label_t *) a;
-    const vertex_label_t *g = (const vertex_label_t *) b;
-    
-    if(*f < *g)
-        return -1;
-    else if(*f > *g)
-        return 1;
-    else
-        return 0;
+    while((cursor < end) && ((*cursor == ' ') || (*cursor == '\t')))
+        cursor++;
+    return cursor;
 }
 
 /**
- * @brief Compares two vertex ids.
- * @param a First label.
- * @param b second label.
- * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
+ * @brief Parses a decimal integer with an optional sign.
+ * @details Leading blanks are skipped, just like sscanf does. Values whose magnitude exceeds `INT64_MAX / 10` saturate,
+ * callers only compare them against much smaller bounds.
+ * @param cursor Address of the current position inside the line, advanced behind the number on success.
+ * @param end End of the line.
+ * @param value Address to store the number.
+ * @returns `true` if a number was found, `false` otherwise.
  */
-int graph_cmp_vertices(const void *a, const void *b)
+static inline bool graph_parse_integer(const char **cursor, const char *end, int64_t *value)
 {
-    const vertex_t *f = (const vertex_t *) a;
-    const vertex_t *g = (const vertex_t *) b;
-    
-    if(*f < *g)
-        return -1;
-    else if(*f > *g)
-        return 1;
-    else
-        return 0;
+    const char *p = graph_skip_blanks(*cursor, end);
+    int64_t result = 0;
+    bool negative = false;
+    const char *digits;
+
+    if((p < end) && ((*p == '-') || (*p == '+')))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+
+    digits = p;
+    while(p < end)
+    {
+        /* unsigned arithmetic turns every non-digit into a value greater than 9 */
+        unsigned int digit = (unsigned int) (unsigned char) *p - (unsigned int) '0';
+
+        if(digit > 9)
+            break;
+        if(result < INT64_MAX / 10)
+            result = 10 * result + (int64_t) digit;
+        p++;
+    }
+
+    if(p == digits)
+        return false;
+
+    *value = negative ? -result : result;
+    *cursor = p;
+    return true;
 }
 
-/**
- * @brief Compares two edges.
- * @param a First edge.
- * @param b second edge.
- * @returns `-1` if `a` is smaller than `b`, `0` if they are equal, or `1` if `a` is greater than `b`.
- */
-int graph_cmp_edges(const void *a, const void *b)
+/** @brief Kinds of lines of a DIMACS file. */
+typedef enum GRAPH_DIMACS_LINE_TYPES
 {
-    const edge_t *f = (const edge_t *) a;
-    const edge_t *g = (const edge_t *) b;
-    
-    if(f->from < g->from)
-        return -1;
-    else if(f->from > g->from)
-        return 1;
-    else if(f->to < g->to)
-        return -1;
-    else if(f->to > g->to)
-        return 1;
-    else
-        return 0;
-}
+    GRAPH_LINE_IGNORED,
+    GRAPH_LINE_COMMENT,
+    GRAPH_LINE_PROBLEM,
+    GRAPH_LINE_EDGE,
+    GRAPH_LINE_BAD_PROBLEM,
+    GRAPH_LINE_BAD_EDGE,
+    GRAPH_LINE_BAD_VERTEX
+} graph_line_type_t;
 
 /**
- * @brief Initializes a graph builder structure.
- * @param builder Pointer to uninitialized builder structure.
+ * @brief Parses the next line of a DIMACS file.
+ * @param cursor Address of the current position, advanced to the start of the next line.
+ * @param end End of the file.
+ * @param text Address to store the start of a comment line.
+ * @param length Address to store the length of a comment line without its line break.
+ * @param first Address to store the number of vertices of a 'problem' line or the first endpoint of an 'edge' line.
+ * @param second Address to store the number of edges of a 'problem' line or the second endpoint of an 'edge' line.
+ * @returns Type of the line.
  */
-void gbuild_init(gbuild_t *builder)
+static graph_line_type_t graph_dimacs_next_line(const char **cursor, const char *end, const char **text, int *length, uint32_t *first, uint32_t *second)
 {
-    builder->max_vertex_label = 0;
-    stack_init(&(builder->vertex_labels), sizeof(vertex_label_t));
-    stack_init(&(builder->edges), sizeof(edge_t));
+    const char *line = *cursor;
+    const char *newline = (const char *) memchr(line, '\n', (size_t) (end - line));
+    const char *line_end = (newline != NULL) ? newline : end;
+    int64_t u, v;
+    
+    /* continue behind the line */
+    *cursor = (newline != NULL) ? newline + 1 : end;
+    
+    /* chop off carriage-return */
+    if((line_end > line) && (line_end[-1] == '\r'))
+        line_end--;
+    
+    /* skip unimportant lines */
+    if(line_end == line)
+        return GRAPH_LINE_IGNORED;
+    
+    switch(*line)
+    {
+        case 'c':
+            /* c This is an example of a comment line. */
+            *text = line;
+            *length = (int) (line_end - line);
+            return GRAPH_LINE_COMMENT;
+        
+        case 'p':
+            /* p FORMAT NODES EDGES */
+            line = graph_skip_blanks(line + 1, line_end);
+            if((line_end - line < 4) || (memcmp(line, "edge", 4) != 0))
+                return GRAPH_LINE_BAD_PROBLEM;
+            
+            line += 4;
+            if(!graph_parse_integer(&line, line_end, &u) || !graph_parse_integer(&line, line_end, &v)
+                || (u < 0) || (u > UINT32_MAX) || (v < 0) || (v > UINT32_MAX))
+                return GRAPH_LINE_BAD_PROBLEM;
+            
+            *first = (uint32_t) u;
+            *second = (uint32_t) v;
+            return GRAPH_LINE_PROBLEM;
+        
+        case 'e':
+            /* e W V */
+            line++;
+            if(!graph_parse_integer(&line, line_end, &u) || !graph_parse_integer(&line, line_end, &v))
+                return GRAPH_LINE_BAD_EDGE;
+            
+            if((u <= 0) || (v <= 0) || (u > INT32_MAX) || (v > INT32_MAX) || (u == v))
+                return GRAPH_LINE_BAD_VERTEX;
+            
+            *first = (uint32_t) u;
+            *second = (uint32_t) v;
+            return GRAPH_LINE_EDGE;
+        
+        default:
+            return GRAPH_LINE_IGNORED;
+    }
 }
 
 /**
- * @brief Destroys a graph builder.
- * @details Releases all memory that was allocated.
- * @param builder Builder to destroy.
+ * @brief Removes consecutive duplicates from a sorted array.
+ * @param data Array.
+ * @param n Number of elements.
+ * @param size Size in bytes of one element.
+ * @param compar Function that compares two elements.
+ * @returns Number of distinct elements, they are moved to the front of the array.
  */
-void gbuild_destroy(gbuild_t *builder)
+static uint32_t graph_unique(uint8_t *data, uint32_t n, uint32_t size, int (*compar)(const void *, const void *))
 {
-    stack_destroy(&(builder->vertex_labels));
-    stack_destroy(&(builder->edges));
+    uint32_t kept = 0;
+    
+    for(uint32_t i = 0; i < n; i++)
+    {
+        if((kept > 0) && (compar(data + (size_t) (kept - 1) * size, data + (size_t) i * size) == 0))
+            continue;
+        if(kept != i)
+            memcpy(data + (size_t) kept * size, data + (size_t) i * size, size);
+        kept++;
+    }
+    
+    return kept;
 }
 
 /**
- * @brief Adds a vertex to a graph builder.
- * @param builder Pointer to initialized builder structure.
- * @param vertex_label Label of the vertex to be added.
+ * @brief Sorts edges, removes duplicates and collects the labels of their endpoints.
+ * @param edges Edges whose first endpoint is the smaller one.
+ * @param labels Empty stack that receives the labels, sorted and without duplicates.
+ * @returns `true` on success, `false` if memory ran out.
  */
-void gbuild_add_vertex(gbuild_t *builder, vertex_label_t vertex_label)
+static bool graph_collect_labels(stack_t *edges, stack_t *labels)
 {
-    if(vertex_label > builder->max_vertex_label)
-        builder->max_vertex_label = vertex_label;
+    edge_t *edge_iter;
     
-    /* check if vertex was added before, only add if not already contained in list */
-    if(!stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &vertex_label, NULL))
+    stack_sort(edges, graph_cmp_edges);
+    edges->n = graph_unique(edges->data, edges->n, sizeof(edge_t), graph_cmp_edges);
+    
+    if(!stack_reserve(labels, 2 * edges->n))
+        return false;
+    edge_iter = (edge_t *) edges->data;
+    for(uint32_t i = 0; i < edges->n; i++, edge_iter++)
     {
-        /* vertex_label is not in list yet, so add it and resort the list */
-        stack_push(&(builder->vertex_labels), &vertex_label);
-        stack_sort(&(builder->vertex_labels), graph_cmp_vertex_labels);
+        stack_push(labels, &(edge_iter->from));
+        stack_push(labels, &(edge_iter->to));
     }
+    
+    stack_sort(labels, graph_cmp_vertex_labels);
+    labels->n = graph_unique(labels->data, labels->n, sizeof(vertex_label_t), graph_cmp_vertex_labels);
+    return true;
 }
 
 /**
- * @brief Adds an edge to a graph builder.
- * @param builder Pointer to an initialized builder structure.
- * @param from Vertex label of the first endpoint of the edge.
- * @param to Vertex label of the second endpoint of the edge.
+ * @brief Parses a DIMACS file line by line and creates the graph.
+ * @details Edges are collected as they are read, their labels are sorted once at the end.
+ * @param graph Pointer to an uninitialized graph structure, `NULL` to only check the file for errors.
+ * @param input Contents of the file.
+ * @param show_comments Comments inside the file will be printed if set to `true`.
+ * @returns `false` on error, `true` on success.
  */
-void gbuild_add_edge(gbuild_t *builder, vertex_label_t from, vertex_label_t to)
+static bool graph_parse_dimacs(graph_t *graph, const graph_input_t const *input, const bool show_comments)
 {
-    bool add_from, add_to;
-    edge_t edge;
+    const char *cursor, *end, *text, *error = NULL;
+    int length;
+    uint32_t first, second, m = 0, last_edge = 0;
+    bool problem_desc = false;
+    gbuild_t builder;
     
-    if(from > to)
+    /* initialize graph builder structure to which edges from the file will be added */    
+    gbuild_init(&builder);
+    
+    end = input->data + input->size;
+    for(cursor = input->data; (cursor < end) && (error == NULL); )
     {
-        vertex_label_t tmp = from;
-        from = to;
-        to = tmp;
+        graph_line_type_t type = graph_dimacs_next_line(&cursor, end, &text, &length, &first, &second);
+        
+        if((type == GRAPH_LINE_COMMENT) && show_comments)
+            fprintf(stdout, "Info: %.*s\n", length, text);
+        else if(((type == GRAPH_LINE_PROBLEM) || (type == GRAPH_LINE_BAD_PROBLEM)) && problem_desc)
+            error = "multiple 'problem' descriptions in input file";
+        else if(type == GRAPH_LINE_BAD_PROBLEM)
+            error = "could not parse 'problem' description in input file";
+        else if(type == GRAPH_LINE_PROBLEM)
+        {
+            m = second;
+            problem_desc = true;
+            
+            /* every edge line takes at least six bytes, do not trust m beyond that */
+            if(graph == NULL)
+                continue;
+            else if((uint64_t) m <= (uint64_t) (end - cursor) / 6)
+                stack_reserve(&(builder.edges), m);
+            else
+                stack_reserve(&(builder.edges), (uint32_t) ((end - cursor) / 6));
+        }
+        else if(type == GRAPH_LINE_BAD_EDGE)
+            error = "could not parse 'edge' description";
+        else if(type == GRAPH_LINE_BAD_VERTEX)
+            error = "invalid range for vertex ids in 'edge' description";
+        else if((type == GRAPH_LINE_EDGE) && (last_edge == m))
+            error = "too many edges in input file";
+        else if(type == GRAPH_LINE_EDGE)
+        {
+            edge_t edge;
+            
+            edge.from = (first < second) ? first : second;
+            edge.to = (first < second) ? second : first;
+            if((graph != NULL) && !stack_push(&(builder.edges), &edge))
+                error = "could not allocate memory to store edges of input file";
+            last_edge++;
+        }
     }
     
-    add_from = !stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &from, NULL);
-    add_to = !stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &to, NULL);
-    
-    if(add_from)
-        stack_push(&(builder->vertex_labels), &from);
-    
-    if(add_to)
-        stack_push(&(builder->vertex_labels), &to);
+    if(error != NULL)
+    {
+        fprintf(stderr, "Error: %s\n", error);
+        gbuild_destroy(&builder);
+        return false;
+    }
+    else if(graph == NULL)
+    {
+        gbuild_destroy(&builder);
+        return true;
+    }
     
-    if(add_from || add_to)
-        stack_sort(&(builder->vertex_labels), graph_cmp_vertex_labels);
-
-    edge.from = from;
-    edge.to = to;
-        
-    stack_push(&(builder->edges), &edge);
+    if(!graph_collect_labels(&(builder.edges), &(builder.vertex_labels)))
+    {
+        fprintf(stderr, "Error: could not allocate memory to store vertex labels of input file\n");
+        gbuild_destroy(&builder);
+        return false;
+    }
+    builder.sorted = true;
+    if(!stack_isempty(&(builder.vertex_labels)))
+        stack_top(&(builder.vertex_labels), &(builder.max_vertex_label));
 
+    if(!gbuild_create_graph(&builder, graph))
+    {
+        gbuild_destroy(&builder);
+        return false;
+    }
+    gbuild_destroy(&builder);
+    return true;
 }
 
 /**
- * @brief Returns the number of distince vertices that were added to the builder.
- * @param builder Pointer to an initialized builder structure.
- * @returns Number of distinct vertices.
+ * @brief Reads a graph in DIMACS format from a file.
+ * @details The file is mapped into memory and scanned in place, lines are found with memchr and numbers are parsed by hand.
+ * @param graph Pointer to an uninitialized graph structure.
+ * @param filename File to read from disk.
+ * @param show_comments Comments inside the file will be printed if set to `true`.
+ * @returns `false` on error, `true` on success.
  */
-uint32_t gbuild_num_vertices(gbuild_t *builder)
+bool graph_load_dimacs(graph_t *graph, const char *filename, const bool show_comments)
 {
-    return stack_height(&(builder->vertex_labels));
+    graph_input_t input;
+    bool result;
+    
+    if(!graph_input_open(&input, filename))
+        return false;
+    
+    result = graph_parse_dimacs(graph, &input, show_comments);
+    graph_input_close(&input);
+    return result;
 }
 
-/**
- * @brief Returns the number of edges that were added to the builder.
- * @param builder Pointer to an initialized builder structure.
- * @returns Number of edges that were added.
- */
-uint32_t gbuild_num_edges(gbuild_t *builder)
+/** @brief Part of a DIMACS file that is parsed by one thread of graph_load_dimacs_parallel. */
+struct _graph_chunk_s
 {
-    return stack_height(&(builder->edges));
-}
+    /** @brief First byte of the chunk, the start of a line. */
+    const char *begin;
+    /** @brief Byte behind the chunk, the start of a line or the end of the file. */
+    const char *end;
+    /** @brief Edges of the chunk, sorted and without duplicates once the chunk is parsed. */
+    stack_t edges;
+    /** @brief Distinct vertex labels of the chunk, sorted. */
+    stack_t labels;
+    /** @brief Number of 'edge' lines, including duplicates. */
+    uint32_t num_edge_lines;
+    /** @brief Number of 'edge' lines in front of the first 'problem' line of the chunk. */
+    uint32_t num_early_edges;
+    /** @brief Number of 'problem' lines. */
+    uint32_t num_problems;
+    /** @brief Number of edges announced by the first 'problem' line. */
+    uint32_t m;
+    /** @brief Set if the chunk contains a malformed line or memory ran out. */
+    bool failed;
+};
+typedef struct _graph_chunk_s graph_chunk_t;
 
 /**
- * @brief Tests whether the builder has no edges.
- * @param builder Pointer to an initialized builder structure.
- * @returns `true` if the builder does not contain any edges, `false` otherwise.
+ * @brief Parses a chunk of a DIMACS file, runs on its own thread.
+ * @details Besides parsing, the thread sorts the edges of its chunk and collects their labels, so the work of gbuild_create_graph
+ * overlaps with the parsing of the other chunks. Nothing is printed, a chunk with errors is only flagged.
+ * @param argument Chunk to parse.
+ * @returns `NULL`.
  */
-bool gbuild_is_trivial(gbuild_t *builder)
+static void *graph_chunk_parse(void *argument)
 {
-    return (stack_height(&(builder->edges)) == 0);
+    graph_chunk_t *chunk = (graph_chunk_t *) argument;
+    const char *cursor, *text;
+    int length;
+    uint32_t first, second;
+    
+    for(cursor = chunk->begin; (cursor < chunk->end) && !chunk->failed; )
+    {
+        switch(graph_dimacs_next_line(&cursor, chunk->end, &text, &length, &first, &second))
+        {
+            case GRAPH_LINE_PROBLEM:
+                if(chunk->num_problems == 0)
+                    chunk->m = second;
+                chunk->num_problems++;
+                break;
+            
+            case GRAPH_LINE_EDGE:
+            {
+                edge_t edge;
+                
+                edge.from = (first < second) ? first : second;
+                edge.to = (first < second) ? second : first;
+                if(!stack_push(&(chunk->edges), &edge))
+                    chunk->failed = true;
+                
+                if(chunk->num_problems == 0)
+                    chunk->num_early_edges++;
+                chunk->num_edge_lines++;
+                
+                /* every edge needs two labels below */
+                if(chunk->num_edge_lines > UINT32_MAX / 2)
+                    chunk->failed = true;
+                break;
+            }
+            
+            case GRAPH_LINE_BAD_PROBLEM:
+            case GRAPH_LINE_BAD_EDGE:
+            case GRAPH_LINE_BAD_VERTEX:
+                chunk->failed = true;
+                break;
+            
+            default:
+                break;
+        }
+    }
+    
+    if(!chunk->failed && !graph_collect_labels(&(chunk->edges), &(chunk->labels)))
+        chunk->failed = true;
+    return NULL;
 }
 
+/** @brief Merge of two sorted runs that is executed by one thread of graph_merge_runs. */
+struct _graph_merge_s
+{
+    const uint8_t *first;
+    uint32_t num_first;
+    const uint8_t *second;
+    uint32_t num_second;
+    /** @brief Destination, large enough for both runs. */
+    uint8_t *target;
+    /** @brief Number of distinct elements that were written to `target`. */
+    uint32_t n;
+    /** @brief Size in bytes of one element. */
+    uint32_t size;
+    int (*compar)(const void *, const void *);
+    pthread_t thread;
+    /** @brief `true` if the merge runs on its own thread and needs to be joined. */
+    bool started;
+};
+typedef struct _graph_merge_s graph_merge_t;
+
 /**
- * @brief Finds the vertex id of a vertex given its label.
- * @param builder Pointer to an initialized builder structure.
- * @param vertex_label Vertex label to find the vertex id for.
- * @param result Address to store the vertex id.
- * @remark Vertex labels may change if new vertices are added later on.
- * @returns `true` if the vertex label was found, `false` otherwise.
+ * @brief Merges two sorted runs and drops duplicates, runs on its own thread.
+ * @param argument Merge to execute.
+ * @returns `NULL`.
  */
-bool gbuild_get_vertex_by_label(gbuild_t *builder, const vertex_label_t vertex_label, vertex_t *result)
+static void *graph_merge_pair(void *argument)
 {
-    uint32_t position;
-    bool found = false;
+    graph_merge_t *merge = (graph_merge_t *) argument;
+    const uint8_t *first = merge->first, *second = merge->second;
+    const uint8_t *first_end = first + (size_t) merge->num_first * merge->size;
+    const uint8_t *second_end = second + (size_t) merge->num_second * merge->size;
+    uint8_t *target = merge->target;
+    uint32_t size = merge->size;
     
-    found = stack_binsearch(&(builder->vertex_labels), graph_cmp_vertex_labels, &vertex_label, &position);
-    if(found)
-        *result = position;
+    merge->n = 0;
+    while((first < first_end) || (second < second_end))
+    {
+        const uint8_t *next;
+        
+        int res;
+        
+        if(second == second_end)
+            res = -1;
+        else if(first == first_end)
+            res = 1;
+        else
+            res = merge->compar(first, second);
+        
+        if(res <= 0)
+        {
+            next = first;
+            first += size;
+            
+            /* equal elements are only written once */
+            if(res == 0)
+                second += size;
+        }
+        else
+        {
+            next = second;
+            second += size;
+        }
+        
+        /* runs are free of duplicates, so only the last written element can be equal */
+        if((merge->n > 0) && (merge->compar(target - size, next) == 0))
+            continue;
+        
+        memcpy(target, next, size);
+        target += size;
+        merge->n++;
+    }
     
-    return found;
+    return NULL;
 }
 
 /**
- * @brief Creates a simple, undirected graph from a builder structure.
- * @param builder Pointer to an initialized builder structure.
- * @param graph Pointer to an uninitialized graph structure.
+ * @brief Merges sorted runs without duplicates into one stack.
+ * @details Pairs of runs are merged on their own threads, round after round, until one run is left. The stacks of the runs are
+ * released after the first round, so at most two copies of the elements are held at a time.
+ * @param runs Stacks with sorted elements, destroyed by this function.
+ * @param num_runs Number of stacks, at least one.
+ * @param compar Function that compares two elements.
+ * @param result Pointer to an initialized, empty stack with the same element size, receives the merged elements.
+ * @returns `false` if memory could not be allocated, `true` on success.
  */
-void gbuild_create_graph(gbuild_t *builder, graph_t *graph)
+static bool graph_merge_runs(stack_t **runs, uint32_t num_runs, int (*compar)(const void *, const void *), stack_t *result)
 {
-    uint32_t num_vertices = 0, num_edges = 0, num_builder_edges = 0, pos;
-    uint32_t *vertex_degrees, i;
-    edge_t *edge_iter;
+    uint32_t size = runs[0]->size;
+    uint8_t *buffers[2] = {NULL, NULL};
+    const uint8_t **data;
+    uint32_t *counts;
+    graph_merge_t *merges;
+    uint64_t total = 0;
+    uint32_t current = 0;
+    bool success = true;
     
-    graph->num_vertices = 0;
-    graph->num_edges = 0;
-    graph->labels = NULL;
-    graph->positions = NULL;
-    graph->edges = NULL;
+    for(uint32_t i = 0; i < num_runs; i++)
+        total += runs[i]->n;
     
-    num_vertices = gbuild_num_vertices(builder);
-    if(num_vertices == 0)
-        return;
-    else
-        graph->num_vertices = num_vertices;
-        
-    graph->labels = (vertex_label_t *) malloc(sizeof(vertex_label_t) * num_vertices);
-    if(graph->labels == NULL)
+    data = (const uint8_t **) malloc(sizeof(const uint8_t *) * num_runs);
+    counts = (uint32_t *) malloc(sizeof(uint32_t) * num_runs);
+    merges = (graph_merge_t *) malloc(sizeof(graph_merge_t) * num_runs);
+    if((total > UINT32_MAX) || (data == NULL) || (counts == NULL) || (merges == NULL)
+        || ((buffers[0] = (uint8_t *) malloc((size_t) total * size + 1)) == NULL))
+        success = false;
+    
+    for(uint32_t i = 0; success && (i < num_runs); i++)
     {
-        fprintf(stderr, "Error: could not allocate memory to store vertex labels\n");
-        exit(0);
+        data[i] = runs[i]->data;
+        counts[i] = runs[i]->n;
     }
     
-    memcpy(graph->labels, builder->vertex_labels.data, sizeof(vertex_label_t) * num_vertices);
+    /* a single run only needs to be copied */
+    if(success && (num_runs == 1))
+    {
+        memcpy(buffers[0], data[0], (size_t) counts[0] * size);
+        data[0] = buffers[0];
+    }
     
-    /* if graph is trivial, we have isolated vertices and then store no edges at all */
-    if(gbuild_is_trivial(builder))
+    while(success && (num_runs > 1))
     {
-        graph->num_edges = 0;
-        graph->positions = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
-        if(graph->positions == NULL)
+        uint32_t num_merges = num_runs / 2;
+        size_t offset = 0;
+        
+        /* the second buffer is allocated once the stacks of the runs were released after the first round */
+        if((buffers[current] == NULL) && ((buffers[current] = (uint8_t *) malloc((size_t) total * size + 1)) == NULL))
         {
-            fprintf(stderr, "Error: could not allocate memory to store edge positions\n");
-            exit(0);
+            success = false;
+            break;
         }
         
-        /* no edges => all positions = 0 */
-        for(i = 0; i < num_vertices; i++)
-            graph->positions[i] = 0;
+        for(uint32_t i = 0; i < num_merges; i++)
+        {
+            graph_merge_t *merge = &(merges[i]);
             
-        return;
+            merge->first = data[2 * i];
+            merge->num_first = counts[2 * i];
+            merge->second = data[2 * i + 1];
+            merge->num_second = counts[2 * i + 1];
+            merge->target = buffers[current] + offset * size;
+            merge->size = size;
+            merge->compar = compar;
+            merge->started = (pthread_create(&(merge->thread), NULL, graph_merge_pair, merge) == 0);
+            
+            /* without a thread, the merge runs right here */
+            if(!merge->started)
+                graph_merge_pair(merge);
+            
+            offset += (size_t) merge->num_first + merge->num_second;
+        }
+        
+        /* the last run of an odd number of runs takes part in the next round */
+        if(num_runs % 2 == 1)
+        {
+            memcpy(buffers[current] + offset * size, data[num_runs - 1], (size_t) counts[num_runs - 1] * size);
+            data[num_merges] = buffers[current] + offset * size;
+            counts[num_merges] = counts[num_runs - 1];
+        }
+        
+        for(uint32_t i = 0; i < num_merges; i++)
+        {
+            if(merges[i].started)
+                pthread_join(merges[i].thread, NULL);
+            data[i] = merges[i].target;
+            counts[i] = merges[i].n;
+        }
+        
+        if(buffers[1] == NULL)
+        {
+            for(uint32_t i = 0; i < num_runs; i++)
+                stack_destroy(runs[i]);
+        }
+        
+        num_runs = num_runs - num_merges;
+        current = 1 - current;
     }
     
-    /* count vertex degrees, use auxiliary array, size is O(n) */
-    vertex_degrees = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
-    if(vertex_degrees == NULL)
+    /* the merged run starts at the beginning of the buffer that was written last, hand it over to the stack */
+    if(success)
     {
-        fprintf(stderr, "Error: could not allocate memory to store vertex degrees\n");
-        exit(0);
+        uint8_t *merged = (uint8_t *) data[0];
+        
+        free(result->data);
+        result->data = merged;
+        result->n = counts[0];
+        result->allocated = (uint32_t) total;
+        
+        if(buffers[0] != merged)
+            free(buffers[0]);
+        if(buffers[1] != merged)
+            free(buffers[1]);
+    }
+    else
+    {
+        free(buffers[0]);
+        free(buffers[1]);
     }
     
-    /* set all degrees to zero */
-    for(i = 0; i < num_vertices; i++)
-        vertex_degrees[i] = 0;
+    for(uint32_t i = 0; i < num_runs; i++)
+        stack_destroy(runs[i]);
     
-    /* sort edge list, so we can iterate and skip duplicates */
-    stack_sort(&(builder->edges), graph_cmp_edges);
-    num_builder_edges = gbuild_num_edges(builder);
+    free(data);
+    free(counts);
+    free(merges);
+    return success;
+}
+
+/**
+ * @brief Reads a graph in DIMACS format from a file on several threads.
+ * @details The file is split into chunks at line breaks, every chunk is parsed, sorted and freed of duplicates on its own thread,
+ * and the sorted chunks are merged pairwise into the builder. Small files, printed comments and a single thread take the
+ * sequential path of graph_load_dimacs. If a chunk finds an error, the file is scanned again sequentially to report the same
+ * error as graph_load_dimacs.
+ * @param graph Pointer to an uninitialized graph structure.
+ * @param filename File to read from disk.
+ * @param show_comments Comments inside the file will be printed if set to `true`.
+ * @param num_threads Number of threads that parse the file.
+ * @returns `false` on error, `true` on success.
+ */
+bool graph_load_dimacs_parallel(graph_t *graph, const char *filename, const bool show_comments, uint32_t num_threads)
+{
+    graph_input_t input;
+    graph_chunk_t *chunks = NULL;
+    pthread_t *threads = NULL;
+    bool *started = NULL;
+    stack_t **runs = NULL;
+    const char *begin, *end;
+    uint32_t num_chunks, num_problems = 0, m = 0;
+    uint64_t num_edge_lines = 0, num_early_edges = 0;
+    gbuild_t builder;
+    bool parsed = true, result;
     
-    edge_iter = (edge_t *) builder->edges.data;
-    num_edges = 0;
+    if(!graph_input_open(&input, filename))
+        return false;
     
-    for(i = 0; i < num_builder_edges; i++, edge_iter++)
+    num_chunks = (uint32_t) ((input.size / GRAPH_PARALLEL_CHUNK_SIZE < num_threads) ? input.size / GRAPH_PARALLEL_CHUNK_SIZE : num_threads);
+    if(show_comments || (num_chunks <= 1))
     {
-        vertex_t vert_from = 0, vert_to = 0;
-        
-        /* skip duplicates */
-        if((i > 0) && (graph_cmp_edges(edge_iter - 1, edge_iter) == 0))
-            continue;
-        
-        /* we assume all vertex_labels can be found in the list, NO ERROR CHECKING */
-        graph_get_vertex_by_label(graph, edge_iter->from, &vert_from);
-        graph_get_vertex_by_label(graph, edge_iter->to, &vert_to);
-        
-        /* increase degree count of edge endpoints */
-        vertex_degrees[vert_from]++;
-        vertex_degrees[vert_to]++;
-        num_edges++;
+        result = graph_parse_dimacs(graph, &input, show_comments);
+        graph_input_close(&input);
+        return result;
     }
     
-    graph->num_edges = num_edges;
-    
-    /* allocate memory */
-    graph->positions = (uint32_t *) malloc(sizeof(uint32_t) * num_vertices);
-    if(graph->positions == NULL)
+    chunks = (graph_chunk_t *) calloc(num_chunks, sizeof(graph_chunk_t));
+    threads = (pthread_t *) malloc(sizeof(pthread_t) * num_chunks);
+    started = (bool *) malloc(sizeof(bool) * num_chunks);
+    runs = (stack_t **) malloc(sizeof(stack_t *) * num_chunks);
+    if((chunks == NULL) || (threads == NULL) || (started == NULL) || (runs == NULL))
     {
-        fprintf(stderr, "Error: could not allocate memory to store edge positions\n");
-        exit(0);
+        free(chunks);
+        free(threads);
+        free(started);
+        free(runs);
+        result = graph_parse_dimacs(graph, &input, false);
+        graph_input_close(&input);
+        return result;
     }
     
-    graph->positions[0] = 0;
-    pos = vertex_degrees[0];
-    for(i = 1; i < num_vertices; i++)
+    /* split the file into chunks of about the same size that end behind a line break */
+    begin = input.data;
+    end = input.data + input.size;
+    for(uint32_t i = 0; i < num_chunks; i++)
     {
-        graph->positions[i] = pos;
-        pos = pos + vertex_degrees[i];
+        const char *chunk_end = input.data + (size_t) ((uint64_t) input.size * (i + 1) / num_chunks);
+        
+        if(chunk_end < begin)
+            chunk_end = begin;
+        if(chunk_end < end)
+        {
+            const char *newline = (const char *) memchr(chunk_end, '\n', (size_t) (end - chunk_end));
+            chunk_end = (newline != NULL) ? newline + 1 : end;
+        }
+        
+        chunks[i].begin = begin;
+        chunks[i].end = chunk_end;
+        stack_init(&(chunks[i].edges), sizeof(edge_t));
+        stack_init(&(chunks[i].labels), sizeof(vertex_label_t));
+        begin = chunk_end;
     }
     
-    graph->edges = (vertex_t *) malloc(sizeof(vertex_t) * 2 * num_edges);
-    if(graph->edges == NULL)
+    for(uint32_t i = 0; i < num_chunks; i++)
     {
-        fprintf(stderr, "Error: could not allocate memory to store edges\n");
-        exit(0);
+        started[i] = (pthread_create(&(threads[i]), NULL, graph_chunk_parse, &(chunks[i])) == 0);
+        
+        /* without a thread, the chunk is parsed right here */
+        if(!started[i])
+            graph_chunk_parse(&(chunks[i]));
     }
     
-    /* go through edge list, insert edges into edge list */
-    edge_iter = (edge_t *) builder->edges.data;
+    for(uint32_t i = 0; i < num_chunks; i++)
+    {
+        if(started[i])
+            pthread_join(threads[i], NULL);
+    }
     
-    for(i = 0; i < num_builder_edges; i++, edge_iter++)
+    /* the file is valid if it has one 'problem' line, no edges in front of it and at most m edges */
+    for(uint32_t i = 0; i < num_chunks; i++)
     {
-        vertex_t vert_from = 0, vert_to = 0;
-        
-        /* skip duplicates */
-        if((i > 0) && (graph_cmp_edges(edge_iter - 1, edge_iter) == 0))
-            continue;
+        if(chunks[i].failed)
+            parsed = false;
         
-        /* we assume all vertex_labels can be found in the list, NO ERROR CHECKING */
-        graph_get_vertex_by_label(graph, edge_iter->from, &vert_from);
-        graph_get_vertex_by_label(graph, edge_iter->to, &vert_to);
+        if((num_problems == 0) && (chunks[i].num_problems > 0))
+        {
+            m = chunks[i].m;
+            num_early_edges += chunks[i].num_early_edges;
+        }
+        else if(num_problems == 0)
+            num_early_edges += chunks[i].num_edge_lines;
         
-        graph->edges[graph->positions[vert_from]] = vert_to;
-        graph->edges[graph->positions[vert_to]] = vert_from;
-        graph->positions[vert_from]++;
-        graph->positions[vert_to]++;
+        num_problems += chunks[i].num_problems;
+        num_edge_lines += chunks[i].num_edge_lines;
     }
     
-    for(i = 0; i < num_vertices; i++)
-        graph->positions[i] = graph->positions[i] - vertex_degrees[i];
-    
-    free(vertex_degrees);
-}
-
-/**
- * @brief Finds the id of a vertex given its label.
- * @param graph Graph.
- * @param vertex_label Label to which the vertex id needs to be found.
- * @param result Address to store the vertex id.
- * @returns `true` if the vertex id could be found, `false` otherwise.
- */
-bool graph_get_vertex_by_label(const graph_t const *graph, const vertex_label_t vertex_label, vertex_t *result)
-{
-    uint32_t l, m, r;
-    int res;
-    
-    l = 0;
-    r = graph->num_vertices;
+    parsed = parsed && (num_problems == 1) && (num_early_edges == 0) && (num_edge_lines <= m);
     
-    while(l < r)
+    gbuild_init(&builder);
+    if(parsed)
     {
-        m = (l + r) / 2;
-        res = graph_cmp_vertex_labels(&(graph->labels[m]), &vertex_label);
-        
-        if(res < 0)
-            l = m + 1;
-        else if(res > 0)
-            r = m;
-        else
-        {
-            if(result)
-                *result = m;
-            return true;
-        }
+        for(uint32_t i = 0; i < num_chunks; i++)
+            runs[i] = &(chunks[i].edges);
+        parsed = graph_merge_runs(runs, num_chunks, graph_cmp_edges, &(builder.edges));
     }
     
-    return false;
-}
-
-/**
- * @brief Reads a graph in DIMACS format from a file.
- * @param builder Pointer to uninitialized builder structure.
- * @param filename File to read from disk.
- * @param show_comments Comments inside the file will be printed if set to `true`.
- * @returns `false` on error, `true` on success.
- */
-bool graph_load_dimacs(graph_t *graph, const char *filename, const bool show_comments)
-{
-    FILE *fd;
-    char buffer[GRAPH_MAX_INPUT_BUFFER_SIZE];
-    size_t len;
-    uint32_t n, m, last_edge = 0;
-    bool problem_desc = false;
-    gbuild_t builder;
+    if(parsed)
+    {
+        for(uint32_t i = 0; i < num_chunks; i++)
+            runs[i] = &(chunks[i].labels);
+        parsed = graph_merge_runs(runs, num_chunks, graph_cmp_vertex_labels, &(builder.vertex_labels));
+    }
     
-    fd = fopen(filename, "rb");
-    if(fd == NULL)
+    for(uint32_t i = 0; i < num_chunks; i++)
     {
-        fprintf(stderr, "Error: could not open input file for reading (%s)\n", strerror(errno));
-        return false;
+        stack_destroy(&(chunks[i].edges));
+        stack_destroy(&(chunks[i].labels));
     }
-
-    /* initialize graph builder structure to which edges from the file will be added */    
-    gbuild_init(&builder);
+    free(chunks);
+    free(threads);
+    free(started);
+    free(runs);
     
-    /* read line by line */
-    while(fgets(buffer, GRAPH_MAX_INPUT_BUFFER_SIZE, fd))
+    if(parsed)
     {
-        len = strlen(buffer);
-        
-        /* skip unimportant lines */
-        if(len <= 1)
-            continue;
-
-        /* chop off carriage-return-new-line */
-        if(buffer[len - 1] == '\n')
-            buffer[--len] = '\0';
-        if(len && (buffer[len - 1] == '\r'))
-            buffer[--len] = '\0';        
+        builder.sorted = true;
+        if(!stack_isempty(&(builder.vertex_labels)))
+            stack_top(&(builder.vertex_labels), &(builder.max_vertex_label));
         
-        if((buffer[0] == 'c') && show_comments)
-        {
-            /* c This is an example of a comment line. */
-            fprintf(stdout, "Info: %s\n", buffer);
-        }
-        else if(buffer[0] == 'p')
-        {
-            /* p FORMAT NODES EDGES */
-            if(problem_desc)
-            {
-                fprintf(stderr, "Error: multiple 'problem' descriptions in input file\n");
-                gbuild_destroy(&builder);
-                fclose(fd);
-                return false;
-            }
-            else
-            {
-                if(sscanf(buffer, "p edge %u %u", &n, &m) != 2)
-                {
-                    fprintf(stderr, "Error: could not parse 'problem' description in input file\n");
-                    gbuild_destroy(&builder);
-                    fclose(fd);
-                    return false;
-                }
-                else
-                    problem_desc = true;
-            }
-        }
-        else if(buffer[0] == 'e')
-        {
-            int u, v;
-            /* e W V */
-            
-            if(sscanf(buffer, "e %i %i", &u, &v) != 2)
-            {
-                fprintf(stderr, "Error: could not parse 'edge' description\n");
-                gbuild_destroy(&builder);
-                fclose(fd);
-                return false;
-            }
-            else if((u <= 0) || (v <= 0) || (u == v))
-            {
-                fprintf(stderr, "Error: invalid range for vertex ids in 'edge' description\n");
-                gbuild_destroy(&builder);
-                fclose(fd);
-                return false;
-            }
-            else if(last_edge == m)
-            {
-                fprintf(stderr, "Error: too many edges in input file\n");
-                gbuild_destroy(&builder);
-                fclose(fd);
-                return false;
-            }
-            else
-            {
-                if(u > v)
-                {
-                    int t = v;
-                    v = u;
-                    u = t;
-                }
-                
-                gbuild_add_edge(&builder, u, v);
-                last_edge++;
-            }
-        }
+        result = gbuild_create_graph(&builder, graph);
+    }
+    else
+    {
+        /* look for the error without building the graph, it is reported the same way graph_load_dimacs does; if there is
+         * none, memory ran out and the sequential parser gets another try */
+        result = graph_parse_dimacs(NULL, &input, false) && graph_parse_dimacs(graph, &input, false);
     }
     
-    fclose(fd);
-    
-    gbuild_create_graph(&builder, graph);
     gbuild_destroy(&builder);
-    return true;
+    graph_input_close(&input);
+    return result;
 }
-
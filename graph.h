@@ -5,9 +5,12 @@
 #include <stdbool.h>
 #include "bitset.h"
 #include "stack.h"
+#include "bucket_queue.h"
 
 /** @brief Maximum length of input buffer that is supposed to store one line */
 #define GRAPH_MAX_INPUT_BUFFER_SIZE 1024
+/** @brief Minimum number of bytes of input per thread of graph_load_dimacs_parallel */
+#define GRAPH_PARALLEL_CHUNK_SIZE (1 << 20)
 
 typedef uint32_t vertex_label_t;
 typedef uint32_t vertex_t;
@@ -15,6 +18,8 @@ typedef uint32_t vertex_t;
 typedef enum GRAPH_ITERATOR_TYPES
 {
     GRAPH_ITER_ALL_VERTICES,
+    /** @brief Visits the vertices of the subgraph itself, used if subgraph_iter_all_vertices could not copy them. */
+    GRAPH_ITER_SCAN_VERTICES,
     GRAPH_ITER_NEIGHBORHOOD
 } graph_iter_type_t;
 
@@ -28,11 +33,46 @@ struct _graph_s
 };
 typedef struct _graph_s graph_t;
 
+/** @brief Marks the end of an adjacency list of the overlay. */
+#define SUBGRAPH_NO_EDGE UINT32_MAX
+
+struct _subgraph_overlay_edge_s
+{
+    /** @brief Endpoint the edge leads to. */
+    vertex_t target;
+    /** @brief Next edge of the same vertex, `SUBGRAPH_NO_EDGE` at the end. */
+    uint32_t next;
+};
+typedef struct _subgraph_overlay_edge_s subgraph_overlay_edge_t;
+
+/** @brief Edges that were added to a subgraph on top of the edges of its base graph. */
+struct _subgraph_overlay_s
+{
+    /** @brief Most recent overlay edge of every vertex of the base graph, `SUBGRAPH_NO_EDGE` if there is none. */
+    uint32_t *heads;
+    /** @brief Both directions of every edge, the edge `uv` is stored as `u -> v` followed by `v -> u`. */
+    stack_t edges;
+    /** @brief Flags neighbors while vertices are merged, a vertex is flagged if its entry equals `stamp`. */
+    uint32_t *marks;
+    uint32_t stamp;
+};
+typedef struct _subgraph_overlay_s subgraph_overlay_t;
+
 struct _subgraph_s
 {
     const graph_t *base;
     bitset_t vertices;
     uint32_t num_vertices;
+    /** @brief Number of edges between vertices of the subgraph. */
+    uint32_t num_edges;
+    /** @brief Number of neighbors inside the subgraph, maintained for every vertex of the base graph. */
+    uint32_t *degrees;
+    /** @brief Vertices of the subgraph sorted by degree, `NULL` unless subgraph_enable_buckets was called. */
+    bq_t *buckets;
+    /** @brief Vertices in the order they were removed, `NULL` unless subgraph_enable_trail was called. */
+    stack_t *trail;
+    /** @brief Edges that are not part of the base graph, `NULL` unless subgraph_enable_overlay was called. */
+    subgraph_overlay_t *overlay;
 };
 typedef struct _subgraph_s subgraph_t;
 
@@ -42,6 +82,8 @@ struct _subgraph_iter_s
     bitset_t vertices;
     bitset_index_t last_vertex, next_vertex;
     uint32_t edge_start, edge_end;
+    /** @brief Next overlay edge that is visited once the edges of the base graph are exhausted. */
+    uint32_t overlay_edge;
 };
 typedef struct _subgraph_iter_s subgraph_iter_t;
 
@@ -63,24 +105,31 @@ struct _graph_builder_s
     stack_t edges;
     /** @brief Greatest vertex label of vertices that were added to the builder. */
     vertex_label_t max_vertex_label;
+    /** @brief `true` if `edges` is known to be sorted, gbuild_create_graph skips sorting then. */
+    bool sorted;
 };
 typedef struct _graph_builder_s gbuild_t;
 
 void gbuild_init(gbuild_t *builder);
 void gbuild_destroy(gbuild_t *builder);
-void gbuild_add_vertex(gbuild_t *builder, vertex_label_t vertex_label);
-void gbuild_add_edge(gbuild_t *builder, vertex_label_t from, vertex_label_t to);
+bool gbuild_add_vertex(gbuild_t *builder, vertex_label_t vertex_label);
+bool gbuild_add_edge(gbuild_t *builder, vertex_label_t from, vertex_label_t to);
 uint32_t gbuild_num_vertices(gbuild_t *builder);
 uint32_t gbuild_num_edges(gbuild_t *builder);
 bool gbuild_is_trivial(gbuild_t *builder);
 bool gbuild_get_vertex_by_label(gbuild_t *builder, const vertex_label_t vertex_label, vertex_t *result);
-void gbuild_create_graph(gbuild_t *builder, graph_t *graph);
+bool gbuild_create_graph(gbuild_t *builder, graph_t *graph);
 
 bool graph_get_vertex_by_label(const graph_t const *graph, const vertex_label_t vertex_label, vertex_t *result);
 bool graph_load_dimacs(graph_t *graph, const char *filename, const bool show_comments);
+bool graph_load_dimacs_parallel(graph_t *graph, const char *filename, const bool show_comments, uint32_t num_threads);
 /* ------------ end of builder -------------- */
 
 bool graph_save_binary(const graph_t const *graph, const char *filename);
+bool graph_save_dimacs(const graph_t const *graph, const char *filename);
+bool graph_save_cover(const graph_t const *graph, const stack_t const *cover, const char *filename);
+bool graph_load_cover(const graph_t const *graph, bitset_t *cover, const char *filename);
+bool graph_verify_cover(const graph_t const *graph, const bitset_t const *cover);
 uint32_t graph_num_vertices(const graph_t const *graph);
 uint32_t graph_num_edges(const graph_t const *graph);
 uint32_t graph_degree(const graph_t const *graph, vertex_t vertex);
@@ -88,9 +137,9 @@ uint32_t graph_get_label(const graph_t const *graph, const vertex_t vertex);
 vertex_t graph_get_edge(const graph_t const *graph, uint32_t index);
 void graph_destroy(graph_t *graph);
 
-void subgraph_init_induced(subgraph_t *subgraph, const graph_t const *base_graph);
-void subgraph_init_copy(subgraph_t *subgraph, const subgraph_t const *source);
-void subgraph_copy(subgraph_t *subgraph, const subgraph_t const *source);
+bool subgraph_init_induced(subgraph_t *subgraph, const graph_t const *base_graph);
+bool subgraph_init_copy(subgraph_t *subgraph, const subgraph_t const *source);
+bool subgraph_copy(subgraph_t *subgraph, const subgraph_t const *source);
 void subgraph_add_vertex(subgraph_t *subgraph, vertex_t vertex);
 void subgraph_remove_vertex(subgraph_t *subgraph, vertex_t vertex);
 void subgraph_destroy(subgraph_t *subgraph);
@@ -98,13 +147,29 @@ bool subgraph_is_connected(const subgraph_t const *subgraph);
 bool subgraph_contains_vertex(const subgraph_t const *subgraph, vertex_t vertex);
 void subgraph_print(const subgraph_t const *subgraph);
 uint32_t subgraph_num_vertices(const subgraph_t const *subgraph);
+uint32_t subgraph_num_edges(const subgraph_t const *subgraph);
 uint32_t subgraph_base_num_vertices(const subgraph_t const *subgraph);
 const graph_t *subgraph_get_base_graph(const subgraph_t const *subgraph);
-void subgraph_find_components(const subgraph_t const *subgraph, stack_t *components);
+bool subgraph_find_components(const subgraph_t const *subgraph, stack_t *components);
 uint32_t subgraph_degree(const subgraph_t const *subgraph, vertex_t vertex);
-
-void subgraph_iter_init_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator);
-void subgraph_iter_all_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator);
+bool subgraph_enable_buckets(subgraph_t *subgraph);
+void subgraph_disable_buckets(subgraph_t *subgraph);
+bool subgraph_has_buckets(const subgraph_t const *subgraph);
+bool subgraph_enable_trail(subgraph_t *subgraph);
+uint32_t subgraph_trail_mark(const subgraph_t const *subgraph);
+void subgraph_trail_rollback(subgraph_t *subgraph, uint32_t mark);
+bool subgraph_enable_overlay(subgraph_t *subgraph);
+bool subgraph_has_overlay(const subgraph_t const *subgraph);
+bool subgraph_is_adjacent(const subgraph_t const *subgraph, vertex_t u, vertex_t v);
+bool subgraph_add_edge(subgraph_t *subgraph, vertex_t u, vertex_t v);
+bool subgraph_merge_vertices(subgraph_t *subgraph, vertex_t vertex, vertex_t other);
+bool subgraph_find_max_degree(const subgraph_t const *subgraph, vertex_t *vertex, uint32_t *degree);
+bool subgraph_find_min_degree(const subgraph_t const *subgraph, vertex_t *vertex, uint32_t *degree);
+bool subgraph_first_of_degree(const subgraph_t const *subgraph, uint32_t degree, vertex_t *vertex);
+bool subgraph_next_of_degree(const subgraph_t const *subgraph, vertex_t *vertex);
+
+bool subgraph_iter_init_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator);
+bool subgraph_iter_all_vertices(const subgraph_t const *subgraph, subgraph_iter_t *iterator);
 void subgraph_iter_neighborhood(const subgraph_t const *subgraph, subgraph_iter_t *iterator, vertex_t vertex);
 bool subgraph_iter_next(const subgraph_t const *subgraph, subgraph_iter_t *iterator, vertex_t *vertex);
 void subgraph_iter_add_vertex(subgraph_iter_t *iterator, vertex_t vertex);
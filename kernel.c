@@ -0,0 +1,188 @@
+#include <assert.h>
+#include "kernel.h"
+
+/** @brief The left copy of a vertex was reached by the alternating search. */
+#define KERNEL_LEFT 1
+/** @brief The right copy of a vertex was reached by the alternating search. */
+#define KERNEL_RIGHT 2
+
+/**
+ * @brief Initializes the workspace of the LP kernels.
+ * @param kernel Pointer to an uninitialized kernel workspace.
+ * @param graph Base graph of all subgraphs that are reduced.
+ * @returns `true` on success, `false` if memory ran out, the workspace can be destroyed either way.
+ * @remark Allocates O(`n`) memory.
+ */
+bool kernel_init(kernel_t *kernel, const graph_t const *graph)
+{
+    bool success;
+
+    assert(kernel);
+
+    success = lb_init(&(kernel->matching), LB_LP, graph);
+    success = bitset_init(&(kernel->left), (bitset_index_t) graph_num_vertices(graph)) && success;
+
+    kernel->reached = (uint8_t *) calloc(graph_num_vertices(graph) + 1, sizeof(uint8_t));
+    kernel->queue = (vertex_t *) malloc(sizeof(vertex_t) * (graph_num_vertices(graph) + 1));
+    if((kernel->reached == NULL) || (kernel->queue == NULL))
+    {
+        fprintf(stderr, "[kernel] Error: could not allocate memory to compute kernels\n");
+        return false;
+    }
+    return success;
+}
+
+/**
+ * @brief Frees memory that was allocated by kernel_init.
+ * @param kernel Pointer to an initialized kernel workspace.
+ */
+void kernel_destroy(kernel_t *kernel)
+{
+    assert(kernel);
+
+    lb_destroy(&(kernel->matching));
+    bitset_destroy(&(kernel->left));
+    free(kernel->reached);
+    free(kernel->queue);
+    kernel->reached = NULL;
+    kernel->queue = NULL;
+}
+
+/**
+ * @brief Marks everything that is reachable from free left copies by alternating paths.
+ * @details Left copies reach their right neighbors by any edge, right copies reach their partner. The result is stored in `kernel->reached`, reset for all vertices of `subgraph` first.
+ * @param kernel Workspace whose matching is maximum.
+ * @param subgraph Subgraph the matching was computed for.
+ * @param left Vertices that have a left copy, all if `NULL`.
+ */
+static void kernel_alternating_search(kernel_t *kernel, const subgraph_t const *subgraph, const bitset_t const *left)
+{
+    lb_t *matching = &(kernel->matching);
+    subgraph_iter_t iter_neighborhood;
+    vertex_t vertex, neighbor;
+    uint32_t head = 0, tail = 0;
+
+    for(uint32_t i = 0; i < matching->num_order; i++)
+    {
+        vertex = matching->order[i];
+        kernel->reached[vertex] = 0;
+
+        if((left == NULL) || bitset_get(left, (bitset_index_t) vertex))
+        {
+            if(matching->mate_left[vertex] == LB_NONE_VERTEX)
+            {
+                kernel->reached[vertex] = KERNEL_LEFT;
+                kernel->queue[tail++] = vertex;
+            }
+        }
+    }
+
+    while(head < tail)
+    {
+        vertex = kernel->queue[head++];
+
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            vertex_t mate = matching->mate_right[neighbor];
+
+            if(kernel->reached[neighbor] & KERNEL_RIGHT)
+                continue;
+            kernel->reached[neighbor] |= KERNEL_RIGHT;
+
+            /* the matching is maximum, so every reached right copy is matched */
+            if((mate != LB_NONE_VERTEX) && !(kernel->reached[mate] & KERNEL_LEFT))
+            {
+                kernel->reached[mate] |= KERNEL_LEFT;
+                kernel->queue[tail++] = mate;
+            }
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+    }
+}
+
+/**
+ * @brief Applies the kernel of Nemhauser and Trotter.
+ * @details A minimum vertex cover of the bipartite double cover is derived from a maximum matching by the theorem of König. Counting the copies of every vertex `v` in that cover gives an optimal half-integral solution `x` of the LP relaxation. There is a minimum vertex cover that contains every vertex with `x(v) = 1` and none with `x(v) = 0`, so both are removed and only the vertices with `x(v) = 1/2` remain. The remaining graph has at most twice as many vertices as its LP optimum, thus at most `2k` vertices if it has a vertex cover of size `k`.
+ * @param kernel Initialized kernel workspace.
+ * @param subgraph Subgraph that is reduced.
+ * @param cover Stack of vertices that receives the vertices with `x(v) = 1`, ignored if `NULL`.
+ * @returns Number of vertices that were added to the vertex cover.
+ */
+int kernel_nt(kernel_t *kernel, subgraph_t *subgraph, stack_t *cover)
+{
+    lb_t *matching = &(kernel->matching);
+    int taken = 0;
+
+    lb_bipartite_matching(matching, subgraph, NULL, UINT32_MAX);
+    kernel_alternating_search(kernel, subgraph, NULL);
+
+    /* the cover of König consists of the left copies that were not reached and the right copies that were */
+    for(uint32_t i = 0; i < matching->num_order; i++)
+    {
+        vertex_t vertex = matching->order[i];
+        uint8_t reached = kernel->reached[vertex];
+
+        if(reached == KERNEL_RIGHT)
+        {
+            if(cover)
+                stack_push(cover, &vertex);
+            subgraph_remove_vertex(subgraph, vertex);
+            taken++;
+        }
+        else if(reached == KERNEL_LEFT)
+            subgraph_remove_vertex(subgraph, vertex);
+    }
+
+    return taken;
+}
+
+/**
+ * @brief Removes a crown from a subgraph.
+ * @details A crown is an independent set `I` together with its neighborhood `H = N(I)` such that `H` can be matched into `I`. Some minimum vertex cover contains `H` and no vertex of `I`. Follows Abu-Khzam et al.: the vertices `O` that are left out by a maximal matching are independent. A maximum matching between `O` and `N(O)` is computed, `I` starts with the vertices of `O` that are unmatched and is extended by the partners of `N(I)` until it does not change any more.
+ * @param kernel Initialized kernel workspace.
+ * @param subgraph Subgraph that is reduced.
+ * @param cover Stack of vertices that receives `H`, ignored if `NULL`.
+ * @returns Number of vertices that were added to the vertex cover.
+ */
+int kernel_crown(kernel_t *kernel, subgraph_t *subgraph, stack_t *cover)
+{
+    lb_t *matching = &(kernel->matching);
+    int taken = 0;
+
+    /* 'marks' flags the vertices that are matched by the maximal matching */
+    lb_matching(matching, subgraph, INT32_MAX, NULL);
+    for(uint32_t i = 0; i < matching->num_order; i++)
+    {
+        vertex_t vertex = matching->order[i];
+
+        if((matching->marks[vertex] != matching->stamp) && (subgraph_degree(subgraph, vertex) > 0))
+            bitset_set(&(kernel->left), (bitset_index_t) vertex);
+        else
+            bitset_clear(&(kernel->left), (bitset_index_t) vertex);
+    }
+
+    lb_bipartite_matching(matching, subgraph, &(kernel->left), UINT32_MAX);
+    kernel_alternating_search(kernel, subgraph, &(kernel->left));
+
+    /* I consists of the reached left copies, H of the reached right copies */
+    for(uint32_t i = 0; i < matching->num_order; i++)
+    {
+        vertex_t vertex = matching->order[i];
+
+        if(kernel->reached[vertex] & KERNEL_RIGHT)
+        {
+            if(cover)
+                stack_push(cover, &vertex);
+            subgraph_remove_vertex(subgraph, vertex);
+            taken++;
+        }
+        else if(kernel->reached[vertex] & KERNEL_LEFT)
+            subgraph_remove_vertex(subgraph, vertex);
+    }
+
+    for(uint32_t i = 0; i < matching->num_order; i++)
+        bitset_clear(&(kernel->left), (bitset_index_t) matching->order[i]);
+
+    return taken;
+}
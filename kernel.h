@@ -0,0 +1,36 @@
+#ifndef KERNEL_H_INCLUDED
+#define KERNEL_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graph.h"
+#include "lower_bound.h"
+
+/**
+ * @defgroup Kernel LP Kernels
+ * @{
+ */
+
+struct _kernel_s
+{
+    /** @brief Workspace of the matchings. */
+    lb_t matching;
+    /** @brief Vertices that get a left copy in the matching of a crown. */
+    bitset_t left;
+    /** @brief Flags of the alternating search, see `KERNEL_LEFT` and `KERNEL_RIGHT`. */
+    uint8_t *reached;
+    /** @brief Queue of the alternating search. */
+    vertex_t *queue;
+};
+typedef struct _kernel_s kernel_t;
+
+bool kernel_init(kernel_t *kernel, const graph_t const *graph);
+void kernel_destroy(kernel_t *kernel);
+int kernel_nt(kernel_t *kernel, subgraph_t *subgraph, stack_t *cover);
+int kernel_crown(kernel_t *kernel, subgraph_t *subgraph, stack_t *cover);
+
+/** @} */
+
+#endif
@@ -0,0 +1,505 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+#include "localsearch.h"
+
+#define LS_NO_EDGE UINT32_MAX
+
+/** @brief Steps between two checks of the clock. */
+#define LS_CLOCK_INTERVAL 1024
+
+/** @brief Factor that decays the weights, in percent. */
+#define LS_DECAY 30
+
+/**
+ * @brief Returns the next value of the random generator of a search.
+ */
+static uint32_t ls_random(ls_t *ls)
+{
+    ls->seed ^= ls->seed << 13;
+    ls->seed ^= ls->seed >> 17;
+    ls->seed ^= ls->seed << 5;
+    return ls->seed;
+}
+
+/**
+ * @brief Returns the seconds that passed since `start`.
+ */
+static double ls_elapsed(const struct timespec *start)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Numbers the edges and stores the number of every edge at both positions in the adjacency lists.
+ * @details The adjacency lists are not sorted, so the edge `uv` with `u < v` gets its number at `u` and is queued at
+ * `v` until `v` is visited.
+ * @returns `true` on success, `false` if memory ran out.
+ */
+static bool ls_number_edges(ls_t *ls)
+{
+    const graph_t *graph = ls->graph;
+    uint32_t *pending, *next, *incoming;
+    uint32_t num_edges = 0, position = 0;
+
+    pending = (uint32_t *) malloc(sizeof(uint32_t) * graph_num_vertices(graph) + 1);
+    next = (uint32_t *) malloc(sizeof(uint32_t) * ls->num_edges + 1);
+    incoming = (uint32_t *) malloc(sizeof(uint32_t) * graph_num_vertices(graph) + 1);
+    if((pending == NULL) || (next == NULL) || (incoming == NULL))
+    {
+        fprintf(stderr, "[localsearch] Error: could not allocate memory to number edges\n");
+        free(pending);
+        free(next);
+        free(incoming);
+        return false;
+    }
+
+    for(vertex_t v = 0; v < graph_num_vertices(graph); v++)
+        pending[v] = LS_NO_EDGE;
+
+    for(vertex_t v = 0; v < graph_num_vertices(graph); v++)
+    {
+        uint32_t end = position + graph_degree(graph, v);
+
+        for(uint32_t e = pending[v]; e != LS_NO_EDGE; e = next[e])
+            incoming[ls->endpoints[2 * e]] = e;
+
+        for(; position < end; position++)
+        {
+            vertex_t u = graph_get_edge(graph, position);
+
+            if(u < v)
+                ls->edge_ids[position] = incoming[u];
+            else
+            {
+                ls->endpoints[2 * num_edges] = v;
+                ls->endpoints[2 * num_edges + 1] = u;
+                ls->edge_ids[position] = num_edges;
+                next[num_edges] = pending[u];
+                pending[u] = num_edges;
+                num_edges++;
+            }
+        }
+    }
+
+    assert(num_edges == ls->num_edges);
+
+    free(pending);
+    free(next);
+    free(incoming);
+    return true;
+}
+
+/**
+ * @brief Initializes a local search for vertex covers of a graph.
+ * @details The search starts from the cover of every vertex, ls_run replaces it by a greedy cover first.
+ * @param ls Pointer to an uninitialized search.
+ * @param graph Graph whose vertex covers are searched, it must not be changed or freed while the search is used.
+ * @param weighted Weights uncovered edges as NuMVC does, this helps on small dense graphs but slows down the search on
+ * large sparse ones.
+ * @param seed Nonzero seed of the random generator.
+ * @returns `true` on success, `false` if memory ran out, the search can be destroyed either way.
+ * @remark Allocates memory linear in the size of the graph.
+ */
+bool ls_init(ls_t *ls, const graph_t const *graph, bool weighted, uint32_t seed)
+{
+    uint32_t n = graph_num_vertices(graph);
+
+    assert(ls && graph);
+
+    ls->graph = graph;
+    ls->num_edges = graph_num_edges(graph);
+    ls->endpoints = (vertex_t *) malloc(sizeof(vertex_t) * 2 * ls->num_edges + 1);
+    ls->edge_ids = (uint32_t *) malloc(sizeof(uint32_t) * 2 * ls->num_edges + 1);
+    ls->weights = (uint32_t *) malloc(sizeof(uint32_t) * ls->num_edges + 1);
+    ls->scores = (int64_t *) calloc(n + 1, sizeof(int64_t));
+    ls->ages = (uint64_t *) calloc(n + 1, sizeof(uint64_t));
+    ls->in_cover = (uint8_t *) malloc(n + 1);
+    ls->conf_change = (uint8_t *) malloc(n + 1);
+    ls->cover = (vertex_t *) malloc(sizeof(vertex_t) * n + 1);
+    ls->cover_index = (uint32_t *) malloc(sizeof(uint32_t) * n + 1);
+    ls->uncovered = (uint32_t *) malloc(sizeof(uint32_t) * ls->num_edges + 1);
+    ls->uncovered_index = (uint32_t *) malloc(sizeof(uint32_t) * ls->num_edges + 1);
+    ls->best = (uint8_t *) malloc(n + 1);
+    if((ls->endpoints == NULL) || (ls->edge_ids == NULL) || (ls->weights == NULL) || (ls->scores == NULL) || (ls->ages == NULL)
+        || (ls->in_cover == NULL) || (ls->conf_change == NULL) || (ls->cover == NULL) || (ls->cover_index == NULL)
+        || (ls->uncovered == NULL) || (ls->uncovered_index == NULL) || (ls->best == NULL))
+    {
+        fprintf(stderr, "[localsearch] Error: could not allocate memory to store local search\n");
+        return false;
+    }
+
+    if(!ls_number_edges(ls))
+        return false;
+
+    for(uint32_t e = 0; e < ls->num_edges; e++)
+        ls->weights[e] = 1;
+    ls->weighted = weighted;
+    ls->total_weight = ls->num_edges;
+    /* NuMVC decays the weights once their average reaches half the number of vertices */
+    ls->max_average = (n / 2 > 1) ? n / 2 : 2;
+
+    ls->cover_size = n;
+    for(vertex_t v = 0; v < n; v++)
+    {
+        ls->in_cover[v] = 1;
+        ls->conf_change[v] = 1;
+        ls->cover[v] = v;
+        ls->cover_index[v] = v;
+        ls->best[v] = 1;
+    }
+    ls->num_uncovered = 0;
+    ls->best_size = n;
+    ls->steps = 0;
+    ls->seed = seed ? seed : 2463534242u;
+    return true;
+}
+
+/**
+ * @brief Frees memory that was allocated by ls_init.
+ * @param ls Pointer to an initialized search.
+ */
+void ls_destroy(ls_t *ls)
+{
+    assert(ls);
+
+    free(ls->endpoints);
+    free(ls->edge_ids);
+    free(ls->weights);
+    free(ls->scores);
+    free(ls->ages);
+    free(ls->in_cover);
+    free(ls->conf_change);
+    free(ls->cover);
+    free(ls->cover_index);
+    free(ls->uncovered);
+    free(ls->uncovered_index);
+    free(ls->best);
+}
+
+/**
+ * @brief Puts a vertex into the cover and updates the uncovered edges and the scores of its neighbors.
+ * @remark Runs in time linear in the degree of the vertex.
+ */
+static void ls_add(ls_t *ls, vertex_t vertex)
+{
+    uint32_t position = ls->graph->positions[vertex];
+    uint32_t end = position + graph_degree(ls->graph, vertex);
+
+    ls->in_cover[vertex] = 1;
+    ls->scores[vertex] = -ls->scores[vertex];
+    ls->ages[vertex] = ls->steps;
+    ls->cover_index[vertex] = ls->cover_size;
+    ls->cover[ls->cover_size++] = vertex;
+
+    for(; position < end; position++)
+    {
+        vertex_t neighbor = graph_get_edge(ls->graph, position);
+        uint32_t e = ls->edge_ids[position];
+
+        ls->conf_change[neighbor] = 1;
+        if(ls->in_cover[neighbor])
+        {
+            /* the neighbor no longer covers this edge alone */
+            ls->scores[neighbor] += ls->weights[e];
+            continue;
+        }
+
+        ls->scores[neighbor] -= ls->weights[e];
+        ls->num_uncovered--;
+        ls->uncovered[ls->uncovered_index[e]] = ls->uncovered[ls->num_uncovered];
+        ls->uncovered_index[ls->uncovered[ls->num_uncovered]] = ls->uncovered_index[e];
+    }
+}
+
+/**
+ * @brief Takes a vertex out of the cover and updates the uncovered edges and the scores of its neighbors.
+ * @remark Runs in time linear in the degree of the vertex.
+ */
+static void ls_remove(ls_t *ls, vertex_t vertex)
+{
+    uint32_t position = ls->graph->positions[vertex];
+    uint32_t end = position + graph_degree(ls->graph, vertex);
+    vertex_t last;
+
+    ls->in_cover[vertex] = 0;
+    ls->conf_change[vertex] = 0;
+    ls->scores[vertex] = -ls->scores[vertex];
+    ls->ages[vertex] = ls->steps;
+    last = ls->cover[--ls->cover_size];
+    ls->cover[ls->cover_index[vertex]] = last;
+    ls->cover_index[last] = ls->cover_index[vertex];
+
+    for(; position < end; position++)
+    {
+        vertex_t neighbor = graph_get_edge(ls->graph, position);
+        uint32_t e = ls->edge_ids[position];
+
+        ls->conf_change[neighbor] = 1;
+        if(ls->in_cover[neighbor])
+        {
+            /* the neighbor covers this edge alone now */
+            ls->scores[neighbor] -= ls->weights[e];
+            continue;
+        }
+
+        ls->scores[neighbor] += ls->weights[e];
+        ls->uncovered_index[e] = ls->num_uncovered;
+        ls->uncovered[ls->num_uncovered++] = e;
+    }
+}
+
+/**
+ * @brief Recomputes all scores from the weights and the current cover.
+ */
+static void ls_compute_scores(ls_t *ls)
+{
+    for(vertex_t v = 0; v < graph_num_vertices(ls->graph); v++)
+        ls->scores[v] = 0;
+
+    for(uint32_t e = 0; e < ls->num_edges; e++)
+    {
+        vertex_t u = ls->endpoints[2 * e], v = ls->endpoints[2 * e + 1];
+
+        if(!ls->in_cover[u] && !ls->in_cover[v])
+        {
+            ls->scores[u] += ls->weights[e];
+            ls->scores[v] += ls->weights[e];
+        }
+        else if(!ls->in_cover[v])
+            ls->scores[u] -= ls->weights[e];
+        else if(!ls->in_cover[u])
+            ls->scores[v] -= ls->weights[e];
+    }
+}
+
+/**
+ * @brief Replaces the current cover by a greedy one.
+ * @details Every uncovered edge takes its endpoint of greater degree, afterwards vertices whose edges are all
+ * covered twice are dropped again, as done by FastVC.
+ */
+static void ls_construct(ls_t *ls)
+{
+    uint32_t n = graph_num_vertices(ls->graph);
+
+    ls->cover_size = 0;
+    for(vertex_t v = 0; v < n; v++)
+        ls->in_cover[v] = 0;
+
+    for(uint32_t e = 0; e < ls->num_edges; e++)
+    {
+        vertex_t u = ls->endpoints[2 * e], v = ls->endpoints[2 * e + 1];
+
+        if(ls->in_cover[u] || ls->in_cover[v])
+            continue;
+        if(graph_degree(ls->graph, u) < graph_degree(ls->graph, v))
+            u = v;
+        ls->in_cover[u] = 1;
+        ls->cover_index[u] = ls->cover_size;
+        ls->cover[ls->cover_size++] = u;
+    }
+
+    ls->num_uncovered = 0;
+    ls_compute_scores(ls);
+    for(vertex_t v = 0; v < n; v++)
+    {
+        ls->conf_change[v] = 1;
+        ls->ages[v] = 0;
+    }
+
+    /* a vertex whose removal uncovers nothing has score 0 */
+    for(uint32_t i = 0; i < ls->cover_size;)
+    {
+        if(ls->scores[ls->cover[i]] == 0)
+            ls_remove(ls, ls->cover[i]);
+        else
+            i++;
+    }
+}
+
+/**
+ * @brief Chooses a vertex of the cover whose removal uncovers little weight.
+ * @details Samples `LS_SAMPLE_SIZE` vertices of the cover (best from multiple selections), ties are broken in favor
+ * of the vertex that was not flipped for the longest time.
+ */
+static vertex_t ls_choose_removal(ls_t *ls)
+{
+    vertex_t best = ls->cover[0];
+
+    if(ls->cover_size <= LS_SAMPLE_SIZE)
+    {
+        for(uint32_t i = 1; i < ls->cover_size; i++)
+        {
+            vertex_t v = ls->cover[i];
+
+            if((ls->scores[v] > ls->scores[best]) || ((ls->scores[v] == ls->scores[best]) && (ls->ages[v] < ls->ages[best])))
+                best = v;
+        }
+        return best;
+    }
+
+    best = ls->cover[ls_random(ls) % ls->cover_size];
+    for(uint32_t i = 1; i < LS_SAMPLE_SIZE; i++)
+    {
+        vertex_t v = ls->cover[ls_random(ls) % ls->cover_size];
+
+        if((ls->scores[v] > ls->scores[best]) || ((ls->scores[v] == ls->scores[best]) && (ls->ages[v] < ls->ages[best])))
+            best = v;
+    }
+    return best;
+}
+
+/**
+ * @brief Chooses the endpoint of a random uncovered edge that enters the cover.
+ */
+static vertex_t ls_choose_addition(ls_t *ls)
+{
+    uint32_t e = ls->uncovered[ls_random(ls) % ls->num_uncovered];
+    vertex_t u = ls->endpoints[2 * e], v = ls->endpoints[2 * e + 1];
+
+    if(!ls->conf_change[u])
+        return v;
+    if(!ls->conf_change[v])
+        return u;
+    if((ls->scores[v] > ls->scores[u]) || ((ls->scores[v] == ls->scores[u]) && (ls->ages[v] < ls->ages[u])))
+        return v;
+    return u;
+}
+
+/**
+ * @brief Increases the weights of all uncovered edges and decays all weights once they grew too large.
+ */
+static void ls_update_weights(ls_t *ls)
+{
+    for(uint32_t i = 0; i < ls->num_uncovered; i++)
+    {
+        uint32_t e = ls->uncovered[i];
+
+        ls->weights[e]++;
+        ls->scores[ls->endpoints[2 * e]]++;
+        ls->scores[ls->endpoints[2 * e + 1]]++;
+    }
+    ls->total_weight += ls->num_uncovered;
+
+    if(ls->total_weight < ls->max_average * ls->num_edges)
+        return;
+
+    ls->total_weight = 0;
+    for(uint32_t e = 0; e < ls->num_edges; e++)
+    {
+        ls->weights[e] = ls->weights[e] * LS_DECAY / 100;
+        if(ls->weights[e] == 0)
+            ls->weights[e] = 1;
+        ls->total_weight += ls->weights[e];
+    }
+    ls_compute_scores(ls);
+}
+
+/**
+ * @brief Stores the current cover as the best one.
+ */
+static void ls_save_best(ls_t *ls)
+{
+    memset(ls->best, 0, graph_num_vertices(ls->graph));
+    for(uint32_t i = 0; i < ls->cover_size; i++)
+        ls->best[ls->cover[i]] = 1;
+    ls->best_size = ls->cover_size;
+}
+
+/**
+ * @brief Searches for a small vertex cover by local search (FastVC, or NuMVC if the search is weighted).
+ * @details Starts from a greedy cover. Whenever the current cover covers all edges it is saved and the vertex of
+ * greatest score leaves it, otherwise one vertex leaves and an endpoint of a random uncovered edge enters, followed
+ * by an increase of the weights of the uncovered edges if enabled. Every update runs in time linear in the degree of the
+ * flipped vertex. The size of the best cover is reported at most once a second while it improves.
+ * @param ls Pointer to an initialized search.
+ * @param target Stops once a cover of at most this size was found.
+ * @param max_steps Stops after this many exchanges, 0 for no limit.
+ * @param max_seconds Stops after this many seconds, 0 for no limit.
+ * @param verbose Reports the size of the best cover while it improves and at the end.
+ * @returns Size of the best cover found.
+ */
+uint32_t ls_run(ls_t *ls, uint32_t target, uint64_t max_steps, double max_seconds, bool verbose)
+{
+    struct timespec start;
+    double last_report = 0.0, elapsed;
+    bool reported = true;
+
+    assert(ls);
+    assert((max_steps > 0) || (max_seconds > 0));
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ls_construct(ls);
+    ls_save_best(ls);
+
+    for(uint64_t step = 0; ls->best_size > target; step++)
+    {
+        if(step % LS_CLOCK_INTERVAL == 0)
+        {
+            elapsed = ls_elapsed(&start);
+            if((max_seconds > 0) && (elapsed >= max_seconds))
+                break;
+            if(verbose && !reported && (elapsed - last_report >= 1.0))
+            {
+                fprintf(stdout, "[info] local search: cover of size %u after %" PRIu64 " steps, %.3f s\n", ls->best_size, ls->steps, elapsed);
+                last_report = elapsed;
+                reported = true;
+            }
+        }
+        if((max_steps > 0) && (step >= max_steps))
+            break;
+
+        ls->steps++;
+        if(ls->num_uncovered == 0)
+        {
+            if(ls->cover_size < ls->best_size)
+            {
+                ls_save_best(ls);
+                reported = false;
+            }
+            /* a graph with edges has no empty cover, a cover of one vertex cannot shrink */
+            if((ls->cover_size <= 1) || (ls->best_size <= target))
+                break;
+            ls_remove(ls, ls_choose_removal(ls));
+            continue;
+        }
+
+        if(ls->cover_size > 0)
+            ls_remove(ls, ls_choose_removal(ls));
+        ls_add(ls, ls_choose_addition(ls));
+        if(ls->weighted)
+            ls_update_weights(ls);
+    }
+
+    if(verbose)
+        fprintf(stdout, "[info] local search: cover of size %u after %" PRIu64 " steps, %.3f s\n", ls->best_size, ls->steps, ls_elapsed(&start));
+    return ls->best_size;
+}
+
+/**
+ * @brief Returns the size of the best cover that ls_run found.
+ * @param ls Pointer to an initialized search.
+ */
+uint32_t ls_best_size(const ls_t const *ls)
+{
+    return ls->best_size;
+}
+
+/**
+ * @brief Pushes the vertices of the best cover onto a stack.
+ * @param ls Pointer to an initialized search.
+ * @param cover Stack of `vertex_t` elements.
+ */
+void ls_get_cover(const ls_t const *ls, stack_t *cover)
+{
+    for(vertex_t v = 0; v < graph_num_vertices(ls->graph); v++)
+    {
+        if(ls->best[v])
+            stack_push(cover, &v);
+    }
+}
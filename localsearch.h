@@ -0,0 +1,63 @@
+#ifndef LOCALSEARCH_H_INCLUDED
+#define LOCALSEARCH_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graph.h"
+
+/**
+ * @defgroup LocalSearch Local Search
+ * @{
+ */
+
+/** @brief Number of cover vertices that are sampled to choose the vertex that leaves the cover. */
+#define LS_SAMPLE_SIZE 50
+
+struct _ls_s
+{
+    const graph_t *graph;
+    uint32_t num_edges;
+    /** @brief Both endpoints of every edge, edge `e` connects `endpoints[2e]` and `endpoints[2e + 1]`. */
+    vertex_t *endpoints;
+    /** @brief Edge of every position of the adjacency lists of the graph. */
+    uint32_t *edge_ids;
+    uint32_t *weights;
+    /** @brief Change of the total weight of uncovered edges if a vertex is flipped, negated. */
+    int64_t *scores;
+    /** @brief Step in which a vertex was flipped the last time. */
+    uint64_t *ages;
+    uint8_t *in_cover;
+    /** @brief Configuration checking, a vertex may only enter the cover if a neighbor was flipped since it left. */
+    uint8_t *conf_change;
+    /** @brief Vertices of the current cover and the position of every vertex in this list. */
+    vertex_t *cover;
+    uint32_t *cover_index;
+    uint32_t cover_size;
+    /** @brief Edges that no vertex of the current cover covers and the position of every edge in this list. */
+    uint32_t *uncovered;
+    uint32_t *uncovered_index;
+    uint32_t num_uncovered;
+    /** @brief Uncovered edges gain weight (NuMVC), otherwise all weights stay 1 (FastVC). */
+    bool weighted;
+    /** @brief Sum of all weights, the weights are decayed once their average reaches `max_average`. */
+    uint64_t total_weight;
+    uint64_t max_average;
+    /** @brief Members of the smallest cover that was found so far. */
+    uint8_t *best;
+    uint32_t best_size;
+    uint64_t steps;
+    uint32_t seed;
+};
+typedef struct _ls_s ls_t;
+
+bool ls_init(ls_t *ls, const graph_t const *graph, bool weighted, uint32_t seed);
+void ls_destroy(ls_t *ls);
+uint32_t ls_run(ls_t *ls, uint32_t target, uint64_t max_steps, double max_seconds, bool verbose);
+uint32_t ls_best_size(const ls_t const *ls);
+void ls_get_cover(const ls_t const *ls, stack_t *cover);
+
+/** @} */
+
+#endif
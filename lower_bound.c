@@ -0,0 +1,440 @@
+#include <assert.h>
+#include <limits.h>
+#include "lower_bound.h"
+
+/** @brief Number of arrays with one entry per vertex that are allocated by lb_init. */
+#define LB_NUM_ARRAYS 11
+
+/**
+ * @brief Initializes the workspace of a lower bound.
+ * @details All memory that is needed to evaluate a bound on subgraphs of `graph` is allocated once, so that lb_compute can be called at every node of a search without allocating.
+ * @param bound Pointer to an uninitialized lower bound.
+ * @param type Bound that is computed by lb_compute.
+ * @param graph Base graph of all subgraphs the bound is computed for.
+ * @returns `true` on success, `false` if memory ran out, the bound can be destroyed either way.
+ * @remark Allocates O(`n`) memory.
+ */
+bool lb_init(lb_t *bound, lb_type_t type, const graph_t const *graph)
+{
+    uint32_t n = graph_num_vertices(graph);
+
+    assert(bound);
+
+    bound->type = type;
+    bound->num_vertices = n;
+    bound->stamp = 0;
+    bound->num_order = 0;
+    bound->neighborhoods = NULL;
+
+    /* one more element, so that graphs without vertices don't cause a zero-sized allocation */
+    bound->order = (vertex_t *) calloc(LB_NUM_ARRAYS * ((size_t) n) + 1, sizeof(uint32_t));
+    if(bound->order == NULL)
+    {
+        fprintf(stderr, "[lb] Error: could not allocate memory to compute lower bounds\n");
+        return false;
+    }
+
+    bound->marks = bound->order + n;
+    bound->cliques = bound->marks + n;
+    bound->sizes = bound->cliques + n;
+    bound->counts = bound->sizes + n;
+    bound->owners = bound->counts + n;
+    bound->mate_left = bound->owners + n;
+    bound->mate_right = bound->mate_left + n;
+    bound->dist = bound->mate_right + n;
+    bound->cursor = bound->dist + n;
+    bound->queue = bound->cursor + n;
+
+    bound->neighborhoods = (subgraph_iter_t *) malloc(sizeof(subgraph_iter_t) * (((size_t) n) + 1));
+    if(bound->neighborhoods == NULL)
+    {
+        fprintf(stderr, "[lb] Error: could not allocate memory to compute lower bounds\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Frees memory that was allocated by lb_init.
+ * @param bound Pointer to an initialized lower bound.
+ */
+void lb_destroy(lb_t *bound)
+{
+    assert(bound);
+
+    free(bound->order);
+    bound->order = NULL;
+    free(bound->neighborhoods);
+    bound->neighborhoods = NULL;
+}
+
+/**
+ * @brief Starts a new computation, so that no vertex is flagged.
+ * @param bound Pointer to an initialized lower bound.
+ */
+static void lb_next_stamp(lb_t *bound)
+{
+    bound->stamp++;
+    if(bound->stamp == 0)
+    {
+        /* flags of earlier computations might match again */
+        for(uint32_t i = 0; i < bound->num_vertices; i++)
+            bound->marks[i] = 0;
+        bound->stamp = 1;
+    }
+}
+
+/**
+ * @brief Stores the vertices of a subgraph in `bound->order`.
+ * @details Greedy heuristics find larger matchings and cliques if vertices of small degree are visited first. This order is used if the subgraph has degree buckets, otherwise vertices are stored by their index.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ */
+static void lb_collect_vertices(lb_t *bound, const subgraph_t const *subgraph)
+{
+    vertex_t vertex;
+
+    bound->num_order = 0;
+
+    if(subgraph_has_buckets(subgraph))
+    {
+        uint32_t mindeg, maxdeg;
+
+        if(!subgraph_find_min_degree(subgraph, &vertex, &mindeg))
+            return;
+        subgraph_find_max_degree(subgraph, &vertex, &maxdeg);
+
+        for(uint32_t degree = mindeg; degree <= maxdeg; degree++)
+        {
+            bool found = subgraph_first_of_degree(subgraph, degree, &vertex);
+
+            for(; found; found = subgraph_next_of_degree(subgraph, &vertex))
+                bound->order[bound->num_order++] = vertex;
+        }
+    }
+    else
+    {
+        subgraph_iter_t iter_vertices;
+
+        subgraph_iter_all_vertices(subgraph, &iter_vertices);
+        while(subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+            bound->order[bound->num_order++] = vertex;
+        subgraph_iter_destroy(&iter_vertices);
+    }
+}
+
+/**
+ * @brief Computes the lower bound that was selected by lb_init.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ * @param limit The computation may stop as soon as the bound is known to exceed `limit`.
+ * @returns Lower bound on the size of a minimum vertex cover of `subgraph`, `0` for `LB_NONE`.
+ */
+int lb_compute(lb_t *bound, const subgraph_t const *subgraph, int limit)
+{
+    switch(bound->type)
+    {
+        case LB_NONE:
+            return 0;
+        case LB_MATCHING:
+            return lb_matching(bound, subgraph, limit, NULL);
+        case LB_CLIQUE:
+            return lb_clique_cover(bound, subgraph, limit);
+        case LB_LP:
+            return lb_lp(bound, subgraph, limit);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Computes the size of a greedy maximal matching.
+ * @details Every vertex cover contains at least one endpoint of each matching edge.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ * @param limit The computation stops once the matching is greater than `limit`, unless `endpoints` is set.
+ * @param endpoints Stack of vertices that receives both endpoints of every matching edge, ignored if `NULL`.
+ * @returns Number of matching edges.
+ */
+int lb_matching(lb_t *bound, const subgraph_t const *subgraph, int limit, stack_t *endpoints)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+    int matching = 0;
+
+    lb_next_stamp(bound);
+    lb_collect_vertices(bound, subgraph);
+
+    for(uint32_t i = 0; i < bound->num_order; i++)
+    {
+        vertex_t vertex = bound->order[i];
+
+        if(bound->marks[vertex] == bound->stamp)
+            continue;
+
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if(bound->marks[neighbor] == bound->stamp)
+                continue;
+
+            bound->marks[vertex] = bound->stamp;
+            bound->marks[neighbor] = bound->stamp;
+            if(endpoints)
+            {
+                stack_push(endpoints, &vertex);
+                stack_push(endpoints, &neighbor);
+            }
+            matching++;
+            break;
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+
+        if((endpoints == NULL) && (matching > limit))
+            break;
+    }
+
+    return matching;
+}
+
+/**
+ * @brief Computes a bound from a greedy partition of the vertices into cliques.
+ * @details Every vertex cover contains all but at most one vertex of each clique, so the bound is the number of vertices minus the number of cliques. Every vertex joins the largest clique it is completely adjacent to, or starts a new one.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ * @param limit The computation stops once the bound is greater than `limit`.
+ * @returns Lower bound on the size of a minimum vertex cover.
+ */
+int lb_clique_cover(lb_t *bound, const subgraph_t const *subgraph, int limit)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+    uint32_t num_cliques = 0;
+    int value = 0;
+
+    lb_next_stamp(bound);
+    lb_collect_vertices(bound, subgraph);
+
+    for(uint32_t i = 0; (i < bound->num_order) && (value <= limit); i++)
+    {
+        vertex_t vertex = bound->order[i];
+        uint32_t best = LB_NONE_VERTEX;
+
+        /* count the neighbors of 'vertex' in every clique it touches */
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            uint32_t clique;
+
+            if(bound->marks[neighbor] != bound->stamp)
+                continue;
+
+            clique = bound->cliques[neighbor];
+            if(bound->owners[clique] != vertex)
+            {
+                bound->owners[clique] = vertex;
+                bound->counts[clique] = 0;
+            }
+
+            bound->counts[clique]++;
+            if((bound->counts[clique] == bound->sizes[clique]) && ((best == LB_NONE_VERTEX) || (bound->sizes[clique] > bound->sizes[best])))
+                best = clique;
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+
+        if(best == LB_NONE_VERTEX)
+        {
+            best = num_cliques++;
+            bound->sizes[best] = 0;
+            bound->owners[best] = LB_NONE_VERTEX;
+        }
+        else
+            value++;
+
+        bound->marks[vertex] = bound->stamp;
+        bound->cliques[vertex] = best;
+        bound->sizes[best]++;
+    }
+
+    return value;
+}
+
+/**
+ * @brief Searches augmenting paths of shortest length from a free left copy.
+ * @param bound Pointer to a lower bound whose BFS layers are up to date.
+ * @param subgraph Subgraph.
+ * @param root Free left copy.
+ * @returns `true` if the matching was augmented, `false` otherwise.
+ */
+static bool lb_augment(lb_t *bound, const subgraph_t const *subgraph, vertex_t root)
+{
+    uint32_t height = 0;
+
+    bound->queue[height++] = root;
+    while(height > 0)
+    {
+        vertex_t left = bound->queue[height - 1];
+        vertex_t right;
+        bool advanced = false;
+
+        while(!advanced && subgraph_iter_next(subgraph, &(bound->neighborhoods[left]), &right))
+        {
+            vertex_t mate = bound->mate_right[right];
+
+            bound->cursor[left] = right;
+            if(mate == LB_NONE_VERTEX)
+            {
+                /* flip the path: every left copy on the stack takes the edge it advanced on last */
+                for(uint32_t i = height; i-- > 0; )
+                {
+                    left = bound->queue[i];
+                    right = bound->cursor[left];
+                    bound->mate_left[left] = right;
+                    bound->mate_right[right] = left;
+                }
+                return true;
+            }
+            else if(bound->dist[mate] == bound->dist[left] + 1)
+            {
+                bound->queue[height++] = mate;
+                advanced = true;
+            }
+        }
+
+        if(!advanced)
+        {
+            /* no augmenting path passes through 'left' in this phase */
+            bound->dist[left] = UINT32_MAX;
+            height--;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Computes a maximum matching of the bipartite double cover of a subgraph.
+ * @details Every vertex `v` has a left copy and a right copy, every edge `uv` connects the left copy of `u` with the right copy of `v` and vice versa. Uses the algorithm of Hopcroft and Karp, started from a greedy matching. The matching is left in `bound->mate_left` and `bound->mate_right`.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ * @param left Only the vertices in this set get a left copy, all vertices of `subgraph` get one if `NULL`.
+ * @param limit The computation stops once the matching is greater than `limit`.
+ * @returns Number of matching edges.
+ * @remark Half of the matching is the optimum of the LP relaxation of vertex cover.
+ */
+uint32_t lb_bipartite_matching(lb_t *bound, const subgraph_t const *subgraph, const bitset_t const *left, uint32_t limit)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+    uint32_t matching = 0;
+    bool augmented = true;
+
+    lb_collect_vertices(bound, subgraph);
+
+    for(uint32_t i = 0; i < bound->num_order; i++)
+    {
+        bound->mate_left[bound->order[i]] = LB_NONE_VERTEX;
+        bound->mate_right[bound->order[i]] = LB_NONE_VERTEX;
+    }
+
+    /* greedy start */
+    for(uint32_t i = 0; i < bound->num_order; i++)
+    {
+        vertex_t vertex = bound->order[i];
+
+        if(left && !bitset_get(left, (bitset_index_t) vertex))
+            continue;
+
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if(bound->mate_right[neighbor] == LB_NONE_VERTEX)
+            {
+                bound->mate_left[vertex] = neighbor;
+                bound->mate_right[neighbor] = vertex;
+                matching++;
+                break;
+            }
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+    }
+
+    while(augmented && (matching <= limit))
+    {
+        uint32_t head = 0, tail = 0;
+        bool free_reached = false;
+
+        /* BFS from all free left copies, layers alternate between unmatched and matched edges */
+        for(uint32_t i = 0; i < bound->num_order; i++)
+        {
+            vertex_t vertex = bound->order[i];
+
+            if(left && !bitset_get(left, (bitset_index_t) vertex))
+                bound->dist[vertex] = UINT32_MAX;
+            else if(bound->mate_left[vertex] == LB_NONE_VERTEX)
+            {
+                bound->dist[vertex] = 0;
+                bound->queue[tail++] = vertex;
+            }
+            else
+                bound->dist[vertex] = UINT32_MAX;
+        }
+
+        while(head < tail)
+        {
+            vertex_t vertex = bound->queue[head++];
+
+            subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+            while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+            {
+                vertex_t mate = bound->mate_right[neighbor];
+
+                if(mate == LB_NONE_VERTEX)
+                    free_reached = true;
+                else if(bound->dist[mate] == UINT32_MAX)
+                {
+                    bound->dist[mate] = bound->dist[vertex] + 1;
+                    bound->queue[tail++] = mate;
+                }
+            }
+            subgraph_iter_destroy(&iter_neighborhood);
+        }
+
+        if(!free_reached)
+            break;
+
+        /* DFS along the layers, the paths of one phase are vertex-disjoint */
+        for(uint32_t i = 0; i < bound->num_order; i++)
+            subgraph_iter_neighborhood(subgraph, &(bound->neighborhoods[bound->order[i]]), bound->order[i]);
+
+        augmented = false;
+        for(uint32_t i = 0; i < bound->num_order; i++)
+        {
+            vertex_t vertex = bound->order[i];
+
+            if((bound->mate_left[vertex] == LB_NONE_VERTEX) && (bound->dist[vertex] == 0) && lb_augment(bound, subgraph, vertex))
+            {
+                matching++;
+                augmented = true;
+            }
+        }
+    }
+
+    return matching;
+}
+
+/**
+ * @brief Computes the optimum of the LP relaxation of vertex cover, rounded up.
+ * @details There is an optimal half-integral solution of the relaxation whose value is half the size of a maximum matching of the bipartite double cover.
+ * @param bound Pointer to an initialized lower bound.
+ * @param subgraph Subgraph.
+ * @param limit The computation stops once the bound is greater than `limit`.
+ * @returns Lower bound on the size of a minimum vertex cover.
+ */
+int lb_lp(lb_t *bound, const subgraph_t const *subgraph, int limit)
+{
+    uint32_t matching_limit = ((limit < 0) || (limit >= INT_MAX / 2)) ? UINT32_MAX : 2 * (uint32_t) limit;
+    uint32_t matching = lb_bipartite_matching(bound, subgraph, NULL, matching_limit);
+
+    return (int) ((matching + 1) / 2);
+}
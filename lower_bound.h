@@ -0,0 +1,73 @@
+#ifndef LOWER_BOUND_H_INCLUDED
+#define LOWER_BOUND_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "graph.h"
+
+/**
+ * @defgroup LowerBound Lower Bounds
+ * @{
+ */
+
+/** @brief Marks unmatched vertices and vertices that were not reached. */
+#define LB_NONE_VERTEX UINT32_MAX
+
+typedef enum LB_TYPES
+{
+    LB_NONE,
+    LB_MATCHING,
+    LB_CLIQUE,
+    LB_LP
+} lb_type_t;
+
+struct _lower_bound_s
+{
+    /** @brief Bound that is computed by lb_compute. */
+    lb_type_t type;
+    /** @brief Number of vertices of the base graph. */
+    uint32_t num_vertices;
+    /** @brief Current value of `marks` that flags a vertex, incremented by every computation. */
+    uint32_t stamp;
+    /** @brief Number of vertices that are stored in `order`. */
+    uint32_t num_order;
+    /** @brief Vertices of the subgraph, in ascending order of degree if the subgraph has degree buckets. */
+    vertex_t *order;
+    /** @brief Flags of the vertices, a vertex is flagged if its entry equals `stamp`. */
+    uint32_t *marks;
+    /** @brief Clique of every vertex. */
+    uint32_t *cliques;
+    /** @brief Size of every clique. */
+    uint32_t *sizes;
+    /** @brief Number of neighbors of the current vertex inside a clique. */
+    uint32_t *counts;
+    /** @brief Vertex that the entry of `counts` belongs to. */
+    uint32_t *owners;
+    /** @brief Partner of every left copy in the bipartite double cover. */
+    vertex_t *mate_left;
+    /** @brief Partner of every right copy in the bipartite double cover. */
+    vertex_t *mate_right;
+    /** @brief BFS layer of every left copy. */
+    uint32_t *dist;
+    /** @brief Right copy that every left copy advanced to last in the augmenting path search. */
+    vertex_t *cursor;
+    /** @brief Position of every left copy in its neighborhood during the augmenting path search, so that edges that were merged into the subgraph are tried as well. */
+    subgraph_iter_t *neighborhoods;
+    /** @brief Queue of the BFS and stack of the augmenting path search. */
+    vertex_t *queue;
+};
+typedef struct _lower_bound_s lb_t;
+
+bool lb_init(lb_t *bound, lb_type_t type, const graph_t const *graph);
+void lb_destroy(lb_t *bound);
+int lb_compute(lb_t *bound, const subgraph_t const *subgraph, int limit);
+int lb_matching(lb_t *bound, const subgraph_t const *subgraph, int limit, stack_t *endpoints);
+int lb_clique_cover(lb_t *bound, const subgraph_t const *subgraph, int limit);
+int lb_lp(lb_t *bound, const subgraph_t const *subgraph, int limit);
+uint32_t lb_bipartite_matching(lb_t *bound, const subgraph_t const *subgraph, const bitset_t const *left, uint32_t limit);
+
+/** @} */
+
+#endif
@@ -1,22 +1,315 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
+#include <limits.h>
+#include <inttypes.h>
+#include <time.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include "graph.h"
 #include "queue.h"
+#include "thread_pool.h"
+#include "lower_bound.h"
+#include "kernel.h"
+#include "ttable.h"
+#include "localsearch.h"
+#include "checkpoint.h"
+#include "stats.h"
 
 //#define VC_SIMPLE_DEBUG
 //#define VC_MAXDEG_DEBUG
 //#define VC_DEGREE2_DEBUG
 
 /*
-    gcc -o vc -Wall -O2 main.c graph.c stack.c bitset.c union_find.c queue.c -std=c99
+    gcc -o vc -Wall -O2 main.c graph.c stack.c bitset.c union_find.c queue.c thread_pool.c bucket_queue.c lower_bound.c kernel.c ttable.c localsearch.c checkpoint.c stats.c -std=c99 -pthread
+    or: make
  */
 
 struct _vc_simple_state_s
 {
     vertex_t u, v; /* endpoints of an uncovered edge */
     int k;
+    bool donated; /* the second branch is explored by another worker */
 };
 typedef struct _vc_simple_state_s vc_simple_state_t;
 
+/*
+    layout of a checkpoint of vc_simple, in native byte order: magic, version, hash of the graph (uint64), k of the root (int32),
+    height of the tree stack, visited nodes (uint64), then u and v of every frame from the bottom up. the top bit of v is set if
+    the frame explores its second branch
+ */
+#define VC_CHECKPOINT_MAGIC 0x4b435356u
+#define VC_CHECKPOINT_VERSION 1
+#define VC_CHECKPOINT_HEADER_SIZE 32
+#define VC_CHECKPOINT_FRAME_SIZE 8
+#define VC_CHECKPOINT_SECOND 0x80000000u
+
+/* periodic snapshots of vc_simple, see vc_simple_checkpoint */
+struct _vc_simple_checkpoint_s
+{
+    ckpt_t writer;
+    uint64_t hash; /* identifies the graph that is searched, see vc_simple_hash */
+    int k; /* budget of the root of the search */
+    uint8_t *buffer; /* snapshot of the current node, large enough for k frames */
+};
+typedef struct _vc_simple_checkpoint_s vc_simple_checkpoint_t;
+
+typedef enum VC_ALGORITHMS
+{
+    VC_ALGO_SIMPLE,
+    VC_ALGO_SIMPLE_PAR,
+    VC_ALGO_MAXDEG,
+    VC_ALGO_MAXDEG_PAR,
+    VC_ALGO_LOCALSEARCH
+} vc_algorithm_t;
+
+struct _vc_algorithm_name_s
+{
+    const char *name;
+    vc_algorithm_t algorithm;
+};
+typedef struct _vc_algorithm_name_s vc_algorithm_name_t;
+
+static const vc_algorithm_name_t vc_algorithm_names[] =
+{
+    { "simple", VC_ALGO_SIMPLE },
+    { "simple-par", VC_ALGO_SIMPLE_PAR },
+    { "maxdeg", VC_ALGO_MAXDEG },
+    { "maxdeg-par", VC_ALGO_MAXDEG_PAR },
+    { "localsearch", VC_ALGO_LOCALSEARCH }
+};
+
+struct _vc_bound_name_s
+{
+    const char *name;
+    lb_type_t bound;
+};
+typedef struct _vc_bound_name_s vc_bound_name_t;
+
+static const vc_bound_name_t vc_bound_names[] =
+{
+    { "none", LB_NONE },
+    { "matching", LB_MATCHING },
+    { "clique", LB_CLIQUE },
+    { "lp", LB_LP }
+};
+
+typedef enum VC_KERNELS
+{
+    VC_KERNEL_NONE,
+    VC_KERNEL_CROWN,
+    VC_KERNEL_NT
+} vc_kernel_t;
+
+struct _vc_kernel_name_s
+{
+    const char *name;
+    vc_kernel_t kernel;
+};
+typedef struct _vc_kernel_name_s vc_kernel_name_t;
+
+static const vc_kernel_name_t vc_kernel_names[] =
+{
+    { "none", VC_KERNEL_NONE },
+    { "crown", VC_KERNEL_CROWN },
+    { "nt", VC_KERNEL_NT }
+};
+
+typedef enum VC_BRANCHINGS
+{
+    VC_BRANCH_MAXDEG,
+    VC_BRANCH_MIRROR,
+    VC_BRANCH_SATELLITE
+} vc_branching_t;
+
+struct _vc_branching_name_s
+{
+    const char *name;
+    vc_branching_t branching;
+};
+typedef struct _vc_branching_name_s vc_branching_name_t;
+
+static const vc_branching_name_t vc_branching_names[] =
+{
+    { "maxdeg", VC_BRANCH_MAXDEG },
+    { "mirror", VC_BRANCH_MIRROR },
+    { "satellite", VC_BRANCH_SATELLITE }
+};
+
+/* optional reductions, the options enable rule 'r' by the bit (1 << r) */
+typedef enum VC_RULES
+{
+    VC_RULE_FOLD,
+    VC_RULE_DOMINATION,
+    VC_RULE_TWIN,
+    VC_RULE_UNCONFINED,
+    VC_RULE_FUNNEL,
+    VC_RULE_DESK,
+    VC_NUM_RULES
+} vc_rule_t;
+
+struct _vc_rule_name_s
+{
+    const char *name;
+    vc_rule_t rule;
+};
+typedef struct _vc_rule_name_s vc_rule_name_t;
+
+static const vc_rule_name_t vc_rule_names[] =
+{
+    { "fold", VC_RULE_FOLD },
+    { "domination", VC_RULE_DOMINATION },
+    { "twin", VC_RULE_TWIN },
+    { "unconfined", VC_RULE_UNCONFINED },
+    { "funnel", VC_RULE_FUNNEL },
+    { "desk", VC_RULE_DESK }
+};
+
+struct _vc_options_s
+{
+    vc_algorithm_t algorithm;
+    uint32_t num_threads;
+    lb_type_t bound; /* prunes search nodes whose remaining graph needs more than k vertices */
+    vc_kernel_t kernel; /* LP kernel that is applied before the search */
+    uint32_t rekernel; /* maxdeg applies the kernel again once the graph shrank to this percentage, 0 to disable */
+    uint32_t rules; /* optional reductions, see vc_rule_enabled */
+    bool components; /* maxdeg solves the components of a disconnected graph one by one */
+    uint32_t table_size; /* MiB of the transposition tables of maxdeg, shared by all workers, 0 to disable */
+    vc_branching_t branching; /* how maxdeg branches on a vertex of maximum degree */
+    double ls_time; /* seconds the local search may run, 0 for no limit */
+    uint64_t ls_steps; /* exchanges the local search may make, 0 for no limit */
+    bool ls_budget; /* set if --ls-time or --ls-steps was given, a warm start gets a budget of its own otherwise */
+    bool ls_weights; /* the local search weights uncovered edges (NuMVC) instead of counting them (FastVC) */
+    bool warmstart; /* the exact algorithms run the local search first and take its vc if it is small enough */
+    bool verbose; /* reports the progress of preprocessing, optimization and local search */
+    double time_limit; /* seconds after which the solvers give up, 0 for no limit, see vc_options_start_clock */
+    struct timespec deadline; /* time of CLOCK_MONOTONIC at which the solvers give up, no limit if tv_sec is 0 */
+    const char *checkpoint_filename; /* simple writes its state to this file every 'checkpoint_interval' seconds, NULL to disable */
+    double checkpoint_interval;
+    const char *resume_filename; /* simple continues from this checkpoint if it belongs to the same graph and k, NULL to disable */
+    stats_t *live; /* statistics that searches publish to every few nodes, NULL to disable */
+};
+typedef struct _vc_options_s vc_options_t;
+
+typedef enum VC_RESULTS
+{
+    VC_RESULT_NO,
+    VC_RESULT_YES,
+    VC_RESULT_UNKNOWN, /* the local search did not find a small enough vc or the deadline passed */
+    VC_RESULT_ERROR /* memory ran out, the run gives no answer */
+} vc_result_t;
+
+struct _vc_stats_s
+{
+    uint64_t nodes; /* search nodes that were visited */
+    uint64_t pruned; /* search nodes that were cut by the lower bound */
+    uint64_t hits[VC_NUM_RULES]; /* applications of every optional rule */
+    uint64_t table_hits; /* search nodes that were answered by the transposition table */
+    uint64_t table_misses;
+    uint64_t table_evictions; /* subproblems that replaced another one in the transposition table */
+    uint32_t max_depth; /* height of the deepest search node */
+    bool expired; /* the deadline passed, a search that did not find a vc does not show that there is none */
+    bool failed; /* memory ran out, the search stopped as if the deadline passed */
+};
+typedef struct _vc_stats_s vc_stats_t;
+
+bool vc_rule_enabled(const vc_options_t const *options, vc_rule_t rule)
+{
+    return (options->rules & (1u << rule)) != 0;
+}
+
+/* connected component whose vertices are stored in 'split_vertices' of the search */
+struct _vc_component_s
+{
+    uint32_t start;
+    uint32_t size;
+};
+typedef struct _vc_component_s vc_component_t;
+
+/* everything one thread needs to run a search */
+struct _vc_search_s
+{
+    const vc_options_t *options;
+    lb_t bound; /* workspace of the lower bound */
+    stack_t tree_stack; /* branching decisions of vc_simple, its height is bounded by k */
+    subgraph_t remaining; /* graph of vc_simple without the partial vc, only maintained if a bound is used */
+    kernel_t kernel; /* workspace of the LP kernel, only allocated if it is applied during the search */
+    uint32_t kernel_size; /* number of vertices when the LP kernel was applied last */
+    uint32_t *marks; /* flags of vertices, a vertex is flagged if its entry equals 'stamp' */
+    uint32_t stamp;
+    uint32_t *counts; /* counters of vertices that are zero outside of the rule that uses them */
+    stack_t touched; /* vertices whose counter is in use, or the result of a rule or branch that uses counters */
+    stack_t neighbors; /* neighbors of the vertex that a rule or branch works on */
+    stack_t split_vertices; /* vertices of the components of all enclosing splits, grouped by component */
+    stack_t splits; /* components of all enclosing splits, smallest first within one split */
+    uint32_t split_depth; /* number of enclosing splits, no branch is spawned inside of a split */
+    uint64_t num_spawned; /* branches that were handed to other workers, a node that spawned did not explore all of its subtree */
+    tt_t table; /* vertex sets of subproblems without a vc of their k, disabled unless maxdeg enables it */
+    stack_t frames; /* nodes of vc_maxdeg_search from the root to the current one */
+    vc_simple_checkpoint_t *checkpoint; /* snapshots of vc_simple, NULL if disabled */
+    vc_stats_t stats;
+    vc_stats_t published; /* part of 'stats' that was added to the live statistics of the options */
+};
+typedef struct _vc_search_s vc_search_t;
+
+typedef enum VC_MAXDEG_STAGES
+{
+    VC_STAGE_ENTER, /* the node was not visited yet */
+    VC_STAGE_FIRST, /* the first branch is explored */
+    VC_STAGE_SECOND /* the second branch is explored */
+} vc_maxdeg_stage_t;
+
+/* node of vc_maxdeg_search */
+struct _vc_maxdeg_frame_s
+{
+    vc_maxdeg_stage_t stage;
+    int k; /* budget of the node, reduced by its kernel */
+    vertex_t vertex; /* vertex of maximum degree that is branched on */
+    int maxdeg;
+    uint32_t mark, cover_mark; /* state when the node was entered, restored unless a vc is found */
+    uint32_t kernel_mark, kernel_cover_mark; /* state after the kernel, where both branches start */
+    uint32_t kernel_size; /* 'kernel_size' of the search when the node was entered */
+    uint64_t num_spawned; /* 'num_spawned' of the search when the node was entered */
+    uint64_t hash; /* hash of the vertices after the kernel, see vc_search_lookup */
+    bool exhausted; /* the whole subtree was explored, so the graph can be remembered */
+    bool spawned; /* the second branch was handed to another worker */
+    bool satellites; /* the second branch excludes the satellites of 'vertex' */
+};
+typedef struct _vc_maxdeg_frame_s vc_maxdeg_frame_t;
+
+struct _vc_simple_task_s
+{
+    subgraph_t vc_partial; /* owned by the task */
+    int k;
+};
+typedef struct _vc_simple_task_s vc_simple_task_t;
+
+struct _vc_simple_parallel_s
+{
+    const subgraph_t *subgraph; /* has degree buckets if a bound is used */
+    stack_t *cover; /* receives the vc of the first worker that finds one, NULL if not requested */
+    int solution_found; /* accessed atomically */
+};
+typedef struct _vc_simple_parallel_s vc_simple_parallel_t;
+
+struct _vc_maxdeg_task_s
+{
+    subgraph_t graph; /* owned by the task */
+    stack_t cover; /* vertices taken on the way to this task, only used if the vc is requested */
+    int k;
+};
+typedef struct _vc_maxdeg_task_s vc_maxdeg_task_t;
+
+struct _vc_maxdeg_parallel_s
+{
+    stack_t *cover; /* receives the vc of the first worker that finds one, NULL if not requested */
+    int solution_found; /* accessed atomically */
+};
+typedef struct _vc_maxdeg_parallel_s vc_maxdeg_parallel_t;
+
 bool find_uncovered_edge(const subgraph_t const *subgraph, const subgraph_t const *vc_partial, vertex_t *u, vertex_t *v)
 {
     subgraph_iter_t iter_vertices, iter_neighborhood;
@@ -48,22 +341,32 @@ bool find_uncovered_edge(const subgraph_t const *subgraph, const subgraph_t cons
 bool find_minmaxdeg_vertex(subgraph_t *subgraph, vertex_t *maxvert, int *maxdeg, vertex_t *minvert, int *mindeg)
 {
     vertex_t vertex;
-    subgraph_iter_t iter_vertices, iter_neighborhood;
+    subgraph_iter_t iter_vertices;
 
     *maxdeg = 0;
     *mindeg = 0;
 
+    if(subgraph_has_buckets(subgraph))
+    {
+        uint32_t degree;
+
+        /* isolated vertices are never needed in a vc */
+        while(subgraph_first_of_degree(subgraph, 0, &vertex))
+            subgraph_remove_vertex(subgraph, vertex);
+
+        if(!subgraph_find_max_degree(subgraph, maxvert, &degree))
+            return false;
+        *maxdeg = (int) degree;
+        subgraph_find_min_degree(subgraph, minvert, &degree);
+        *mindeg = (int) degree;
+        return true;
+    }
+
     subgraph_iter_all_vertices(subgraph, &iter_vertices);
     while(subgraph_iter_next(subgraph, &iter_vertices, &vertex))
     {
-        int deg = 0;
-        vertex_t neighbor;
+        int deg = (int) subgraph_degree(subgraph, vertex);
 
-        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
-        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
-            deg++;
-
-        subgraph_iter_destroy(&iter_neighborhood);
         if(deg > *maxdeg)
         {
             *maxdeg = deg;
@@ -82,7 +385,139 @@ bool find_minmaxdeg_vertex(subgraph_t *subgraph, vertex_t *maxvert, int *maxdeg,
     return (*maxdeg > 0);
 }
 
-bool vc_tree_cycle(subgraph_t *subgraph, int k)
+/* the vertices of the vc are only recorded if 'cover' is set */
+void vc_cover_add(stack_t *cover, vertex_t vertex)
+{
+    if(cover)
+        stack_push(cover, &vertex);
+}
+
+uint32_t vc_cover_mark(const stack_t const *cover)
+{
+    return cover ? stack_height(cover) : 0;
+}
+
+/* adds all vertices of 'source' */
+void vc_cover_append(stack_t *cover, const stack_t const *source)
+{
+    for(uint32_t i = 0; cover && (i < stack_height(source)); i++)
+        stack_push(cover, stack_get_element_ptr(source, i));
+}
+
+/* adds all vertices that are contained in 'vertices' */
+void vc_cover_add_all(stack_t *cover, const subgraph_t const *vertices)
+{
+    subgraph_iter_t iter_vertices;
+    vertex_t vertex;
+
+    if(cover == NULL)
+        return;
+
+    subgraph_iter_all_vertices(vertices, &iter_vertices);
+    while(subgraph_iter_next(vertices, &iter_vertices, &vertex))
+        stack_push(cover, &vertex);
+    subgraph_iter_destroy(&iter_vertices);
+}
+
+/* removes all vertices that were added after 'mark' was taken */
+void vc_cover_restore(stack_t *cover, uint32_t mark)
+{
+    while(cover && (stack_height(cover) > mark))
+        stack_remove_last(cover);
+}
+
+/* reductions that are undone by vc_cover_unfold are recorded as a header with this flag, the number of alternatives in bits 16 to 30 and the number of tests in the lower bits, followed by both alternatives and the tests */
+#define VC_COVER_RECORD 0x80000000u
+
+/* records that the vc of the reduced graph is completed by 'second' if it contains all 'tests', and by 'first' otherwise, both alternatives have 'size' vertices */
+void vc_cover_add_record(stack_t *cover, const vertex_t const *first, const vertex_t const *second, uint32_t size, const vertex_t const *tests, uint32_t num_tests)
+{
+    /* a record that does not fit is left out as a whole, the vc then fails verification instead of being unfolded wrongly */
+    if(cover && !stack_grow(cover, 1 + 2 * size + num_tests))
+        return;
+    vc_cover_add(cover, VC_COVER_RECORD | (size << 16) | num_tests);
+    for(uint32_t i = 0; i < size; i++)
+        vc_cover_add(cover, first[i]);
+    for(uint32_t i = 0; i < size; i++)
+        vc_cover_add(cover, second[i]);
+    for(uint32_t i = 0; i < num_tests; i++)
+        vc_cover_add(cover, tests[i]);
+}
+
+/* replaces the records by vertices of 'graph', latest record first, returns false if memory ran out (the cover still contains records then) */
+bool vc_cover_unfold(stack_t *cover, const graph_t const *graph)
+{
+    bitset_t vertices;
+    stack_t records;
+    uint32_t position;
+    bool success;
+
+    success = stack_init(&records, sizeof(uint32_t));
+    success = bitset_init(&vertices, (bitset_index_t) graph_num_vertices(graph)) && success;
+    for(position = 0; success && (position < stack_height(cover)); position++)
+    {
+        vertex_t vertex = *((vertex_t *) stack_get_element_ptr(cover, position));
+
+        if(vertex & VC_COVER_RECORD)
+        {
+            success = stack_push(&records, &position);
+            position += 2 * ((vertex & ~VC_COVER_RECORD) >> 16) + (vertex & 0xffff);
+        }
+        else
+            bitset_set(&vertices, (bitset_index_t) vertex);
+    }
+
+    if(success && !stack_isempty(&records))
+    {
+        while(stack_pop(&records, &position))
+        {
+            vertex_t *record = (vertex_t *) stack_get_element_ptr(cover, position);
+            uint32_t size = (record[0] & ~VC_COVER_RECORD) >> 16;
+            uint32_t num_tests = record[0] & 0xffff;
+            vertex_t *tests = record + 1 + 2 * size;
+            vertex_t *alternative = record + 1 + size;
+
+            for(uint32_t i = 0; i < num_tests; i++)
+            {
+                if(!bitset_get(&vertices, (bitset_index_t) tests[i]))
+                {
+                    alternative = record + 1;
+                    break;
+                }
+            }
+            for(uint32_t i = 0; i < size; i++)
+                bitset_set(&vertices, (bitset_index_t) alternative[i]);
+        }
+
+        /* the cover does not grow, since every record is longer than the vertices it stands for */
+        vc_cover_restore(cover, 0);
+        for(vertex_t vertex = 0; vertex < graph_num_vertices(graph); vertex++)
+        {
+            if(bitset_get(&vertices, (bitset_index_t) vertex))
+                stack_push(cover, &vertex);
+        }
+    }
+
+    bitset_destroy(&vertices);
+    stack_destroy(&records);
+    return success;
+}
+
+/* degree-1 rule: 'vertex' has exactly one neighbor, which is added to the vc */
+void vc_take_degree1_neighbor(subgraph_t *subgraph, vertex_t vertex, stack_t *cover)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor);
+    subgraph_iter_destroy(&iter_neighborhood);
+    vc_cover_add(cover, neighbor);
+    subgraph_remove_vertex(subgraph, vertex);
+    subgraph_remove_vertex(subgraph, neighbor);
+}
+
+bool vc_tree_cycle(subgraph_t *subgraph, int k, stack_t *cover)
 {
     vertex_t vertex, minvertex;
     int maxdeg, mindeg;
@@ -90,21 +525,42 @@ bool vc_tree_cycle(subgraph_t *subgraph, int k)
     while((k >= 0) && find_minmaxdeg_vertex(subgraph, &vertex, &maxdeg, &minvertex, &mindeg))
     {
         if(maxdeg == 1)
-            return (2 * k >= subgraph_num_vertices(subgraph));
+        {
+            bool solution_found = (2 * k >= subgraph_num_vertices(subgraph));
+
+            if(cover && solution_found && subgraph_has_buckets(subgraph))
+            {
+                /* every component is a single edge, add one of its endpoints to the vc */
+                while(subgraph_first_of_degree(subgraph, 1, &vertex))
+                {
+                    vc_cover_add(cover, vertex);
+                    vc_take_degree1_neighbor(subgraph, vertex, NULL);
+                }
+            }
+            else if(cover && solution_found)
+            {
+                subgraph_iter_t iter_vertices;
+
+                /* every component is a single edge, add one of its endpoints to the vc */
+                subgraph_iter_all_vertices(subgraph, &iter_vertices);
+                while(subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+                {
+                    if(subgraph_contains_vertex(subgraph, vertex))
+                    {
+                        vc_cover_add(cover, vertex);
+                        vc_take_degree1_neighbor(subgraph, vertex, NULL);
+                    }
+                }
+                subgraph_iter_destroy(&iter_vertices);
+            }
+
+            return solution_found;
+        }
         else if(mindeg == 1)
         {
             /* add neighbor of 'minvertex' to the vc */
-            vertex_t neighbor;
-            subgraph_iter_t iter_neighborhood;
-
-            /* find any neighbor of 'minvertex' */
-            subgraph_iter_neighborhood(subgraph, &iter_neighborhood, minvertex);
-            subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor);
-            subgraph_iter_destroy(&iter_neighborhood);
-            
             k--;
-            subgraph_remove_vertex(subgraph, minvertex);
-            subgraph_remove_vertex(subgraph, neighbor);
+            vc_take_degree1_neighbor(subgraph, minvertex, cover);
         }
         else
         {
@@ -121,13 +577,17 @@ bool vc_tree_cycle(subgraph_t *subgraph, int k)
                 subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
                 if(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
                 {
+                    /* every second vertex of the cycle is added to the vc */
+                    if(cycle_length % 2 == 0)
+                        vc_cover_add(cover, vertex);
                     subgraph_remove_vertex(subgraph, vertex);
                     cycle_length++;
                     vertex = neighbor;
                 }
                 else
                 {
-                    /* 'vertex' does not have a neighbor */
+                    /* 'vertex' does not have a neighbor, it closes the cycle */
+                    vc_cover_add(cover, vertex);
                     subgraph_remove_vertex(subgraph, vertex);
                     cycle_removed = true;
                 }
@@ -152,7 +612,13 @@ void compute_discs(const subgraph_t const *subgraph, vertex_t root, int levels)
     vertex_t vertex;
     subgraph_t discs;
 
-    subgraph_init_induced(&discs, subgraph_get_base_graph(subgraph));
+    if((distances == NULL) || !subgraph_init_induced(&discs, subgraph_get_base_graph(subgraph)))
+    {
+        if(distances)
+            subgraph_destroy(&discs);
+        free(distances);
+        return;
+    }
 
     for(int i = 0; i < subgraph_base_num_vertices(subgraph); i++)
         distances[i] = -1;
@@ -190,236 +656,3336 @@ void compute_discs(const subgraph_t const *subgraph, vertex_t root, int levels)
     free(distances);
 }
 
-void vc_buss_kernel(subgraph_t *subgraph, int *k)
+/* returns true if 'vertex' has degree 2 and its neighbors are adjacent, both neighbors are stored in 'neighbor1' and 'neighbor2' */
+bool vc_is_triangle(const subgraph_t const *subgraph, vertex_t vertex, vertex_t *neighbor1, vertex_t *neighbor2)
 {
-    vertex_t maxvertex, minvertex;
-    int maxdeg, mindeg;
+    subgraph_iter_t iter_neighborhood;
 
-    while((*k > 0) && find_minmaxdeg_vertex(subgraph, &maxvertex, &maxdeg, &minvertex, &mindeg))
-    {
-        subgraph_iter_t iter_neighborhood;
-        vertex_t neighbor;
+    if(!subgraph_contains_vertex(subgraph, vertex) || (subgraph_degree(subgraph, vertex) != 2))
+        return false;
 
-        if(mindeg == 1)
-        {
-            subgraph_iter_neighborhood(subgraph, &iter_neighborhood, minvertex);
-            subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor);
-            subgraph_iter_destroy(&iter_neighborhood);
-            subgraph_remove_vertex(subgraph, minvertex);
-            subgraph_remove_vertex(subgraph, neighbor);
-            (*k)--;
-        }
-        else if(maxdeg > *k)
-        {
-            subgraph_remove_vertex(subgraph, maxvertex);
-            (*k)--;
-        }
-        else if(mindeg == 2)
-        {
-            bool found = false;
-            vertex_t vertex;
-            subgraph_iter_t iter_vertices;
-            
-            subgraph_iter_all_vertices(subgraph, &iter_vertices);
-            while((*k > 0) && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
-            {
-                if(subgraph_degree(subgraph, vertex) == 2)
-                {
-                    vertex_t neighbor1, neighbor2, neighbor = 0;
-                    subgraph_iter_t iter_neighborhood;
 #ifdef VC_DEGREE2_DEBUG
-                    fprintf(stdout, "[debug] vertex %u has degree 2\n", vertex);
+    fprintf(stdout, "[debug] vertex %u has degree 2\n", vertex);
 #endif
-                    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
-                    subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor1);
-                    subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor2);
-                    subgraph_iter_destroy(&iter_neighborhood);
-
-                    /* check if neighbors are connected */
-                    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, neighbor1);
-                    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
-                    {
-                        if(neighbor == neighbor2)
-                            break;
-                    }
-                    subgraph_iter_destroy(&iter_neighborhood);
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    subgraph_iter_next(subgraph, &iter_neighborhood, neighbor1);
+    subgraph_iter_next(subgraph, &iter_neighborhood, neighbor2);
+    subgraph_iter_destroy(&iter_neighborhood);
 
-                    if(neighbor == neighbor2)
-                    {
+    /* check if neighbors are connected */
+    return subgraph_is_adjacent(subgraph, *neighbor1, *neighbor2);
+}
+
+void vc_take_triangle(subgraph_t *subgraph, vertex_t vertex, vertex_t neighbor1, vertex_t neighbor2, stack_t *cover)
+{
 #ifdef VC_DEGREE2_DEBUG
-                        fprintf(stdout, "[debug] degree-2 vertex has two connected neighbors\n");
+    fprintf(stdout, "[debug] degree-2 vertex has two connected neighbors\n");
 #endif
-                        found = true;
-                        subgraph_remove_vertex(subgraph, vertex);
-                        subgraph_remove_vertex(subgraph, neighbor1);
-                        subgraph_remove_vertex(subgraph, neighbor2);
-                        (*k) = (*k) - 2;
-                    }
-                }
-            }
-            subgraph_iter_destroy(&iter_vertices);
-            
-            if(!found)
-                break;
-        }
-        else
-            break;
-    }
+    vc_cover_add(cover, neighbor1);
+    vc_cover_add(cover, neighbor2);
+    subgraph_remove_vertex(subgraph, vertex);
+    subgraph_remove_vertex(subgraph, neighbor1);
+    subgraph_remove_vertex(subgraph, neighbor2);
 }
 
-bool vc_maxdeg_recursive(const subgraph_t const *subgraph, int k)
+/* triangle rule: adds both neighbors of degree-2 vertices with adjacent neighbors to the vc, stops once 'budget' is used up (no limit if negative) */
+int vc_take_triangles(subgraph_t *subgraph, int budget, stack_t *cover)
 {
-    vertex_t vertex, minvertex;
-    int maxdeg, mindeg;
-    subgraph_t graph;
-    bool solution_found = false;
-    
-    subgraph_init_copy(&graph, subgraph);
-    
-    /* kernelization: remove vertices of degree 1 or degree > k */
-    vc_buss_kernel(&graph, &k);
+    int taken = 0;
+    vertex_t vertex, neighbor1, neighbor2;
+    subgraph_iter_t iter_vertices;
 
-    if(find_minmaxdeg_vertex(&graph, &vertex, &maxdeg, &minvertex, &mindeg))
+    if(subgraph_has_buckets(subgraph))
     {
-#ifdef VC_MAXDEG_DEBUG
-        fprintf(stdout, "[debug] found maximum degree vertex: %u has %u neighbors\n", vertex, maxdeg);
-#endif
-        if(k > 0)
+        bool found = subgraph_first_of_degree(subgraph, 2, &vertex);
+
+        /* only the degree-2 bucket needs to be visited */
+        while(((budget < 0) || (taken < budget)) && found)
         {
-            /* if the graph consists of trees and cycles, we can solve it in polynomial time */
-            if(maxdeg <= 2)
-                solution_found = vc_tree_cycle(&graph, k);
-            /*else if(maxdeg <= 8)
-            {
-                printf("maxvertex: %u, maxdeg: %u, %u vertices left\n", vertex, maxdeg, subgraph_num_vertices(&graph));
-                compute_discs(&graph, vertex, 4);
-                exit(0);
-            }*/
-            else
+            if(vc_is_triangle(subgraph, vertex, &neighbor1, &neighbor2))
             {
-                subgraph_t subcopy;
-                
-                /* create the first branch: include 'vertex' */
-                subgraph_init_copy(&subcopy, &graph);
-                subgraph_remove_vertex(&subcopy, vertex);
-                solution_found = vc_maxdeg_recursive(&subcopy, k - 1);
-                subgraph_destroy(&subcopy);
-
-                /* create the second branch: include the neighborhood of 'vertex' */
-                if(!solution_found && (maxdeg <= k))
-                {
-                    subgraph_iter_t iter_neighborhood;
-                    vertex_t neighbor;
-                    
-                    subgraph_init_copy(&subcopy, &graph);
-                    subgraph_iter_neighborhood(&subcopy, &iter_neighborhood, vertex);
-                    while(subgraph_iter_next(&subcopy, &iter_neighborhood, &neighbor))
-                    {
-                        subgraph_remove_vertex(&subcopy, neighbor);
-                        k--;
-                    }
+                vertex_t next = vertex;
 
-                    subgraph_iter_destroy(&iter_neighborhood);
-                    subgraph_remove_vertex(&subcopy, vertex);
-                    
-                    solution_found = vc_maxdeg_recursive(&subcopy, k);
-                    subgraph_destroy(&subcopy);
-                }
+                /* the successor must not be removed along with the triangle */
+                do
+                    found = subgraph_next_of_degree(subgraph, &next);
+                while(found && ((next == neighbor1) || (next == neighbor2)));
+
+                vc_take_triangle(subgraph, vertex, neighbor1, neighbor2, cover);
+                taken = taken + 2;
+
+                /* the successor moved to another bucket if it lost a neighbor, start over in that case */
+                if(found && (subgraph_degree(subgraph, next) != 2))
+                    found = subgraph_first_of_degree(subgraph, 2, &next);
+                vertex = next;
             }
+            else
+                found = subgraph_next_of_degree(subgraph, &vertex);
         }
+
+        return taken;
     }
-    else
-        solution_found = (k >= 0);
 
-    subgraph_destroy(&graph);
-    return solution_found;
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(((budget < 0) || (taken < budget)) && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+    {
+        /* skip vertices that were removed by a previous triangle */
+        if(vc_is_triangle(subgraph, vertex, &neighbor1, &neighbor2))
+        {
+            vc_take_triangle(subgraph, vertex, neighbor1, neighbor2, cover);
+            taken = taken + 2;
+        }
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return taken;
 }
 
-bool vc_simple(const subgraph_t const *subgraph, int k)
+/* records that memory ran out, the run stops as if the deadline passed */
+void vc_stats_fail(vc_stats_t *stats)
 {
-    stack_t tree_stack;
-    subgraph_t vc_partial;
-    bool solution_found = false;
-    vc_simple_state_t state;
+    if(stats)
+    {
+        stats->expired = true;
+        stats->failed = true;
+    }
+}
 
-    subgraph_init_induced(&vc_partial, subgraph_get_base_graph(subgraph));
-    stack_init(&tree_stack, sizeof(vc_simple_state_t));
+/* stops a search whose memory ran out, aborts the pool of 'worker' as well */
+void vc_search_fail(vc_search_t *search, tpool_worker_t *worker)
+{
+    vc_stats_fail(&(search->stats));
+    if(worker)
+        tpool_abort(worker->pool);
+}
 
-    state.k = k;
+/* returns false if memory ran out, the search is marked as failed then and can be destroyed */
+bool vc_search_init(vc_search_t *search, const vc_options_t const *options, const subgraph_t const *subgraph)
+{
+    bool success;
 
-    do
+    search->options = options;
+    success = lb_init(&(search->bound), options->bound, subgraph_get_base_graph(subgraph));
+    success = stack_init(&(search->tree_stack), sizeof(vc_simple_state_t)) && success;
+    success = subgraph_init_copy(&(search->remaining), subgraph) && success;
+    if((options->kernel != VC_KERNEL_NONE) && (options->rekernel > 0))
+        success = kernel_init(&(search->kernel), subgraph_get_base_graph(subgraph)) && success;
+    search->kernel_size = subgraph_num_vertices(subgraph);
+    search->marks = (uint32_t *) calloc(subgraph_base_num_vertices(subgraph) + 1, sizeof(uint32_t));
+    if(search->marks == NULL)
     {
-        /* first: find any uncovered edge in the graph. we have a solution if no edge exists */
-        if(!find_uncovered_edge(subgraph, &vc_partial, &state.u, &state.v))
-        {
-#ifdef VC_SIMPLE_DEBUG
-            fprintf(stdout, "[debug] found solution: ");
-            subgraph_print(&vc_partial);
-#endif
-            solution_found = true;
-        }
-        else
-        {
-#ifdef VC_SIMPLE_DEBUG
-            fprintf(stdout, "[debug] found uncovered edge (%u, %u)\n", state.u, state.v);
-#endif
-            if(state.k > 0)
-            {
-                state.k--;
-                stack_push(&tree_stack, &state);
-#ifdef VC_SIMPLE_DEBUG
-                fprintf(stdout, "[debug] adding %u to the vertex cover\n", state.u);
-#endif
-                subgraph_add_vertex(&vc_partial, state.u);
-            }
-            else
+        fprintf(stderr, "Error: could not allocate memory to flag vertices\n");
+        success = false;
+    }
+    search->stamp = 0;
+    search->counts = (uint32_t *) calloc(subgraph_base_num_vertices(subgraph) + 1, sizeof(uint32_t));
+    if(search->counts == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to count neighbors\n");
+        success = false;
+    }
+    /* the rules push every vertex at most once onto these, so they never need to grow */
+    success = stack_init(&(search->touched), sizeof(vertex_t)) && stack_reserve(&(search->touched), subgraph_base_num_vertices(subgraph) + 1) && success;
+    success = stack_init(&(search->neighbors), sizeof(vertex_t)) && stack_reserve(&(search->neighbors), subgraph_base_num_vertices(subgraph) + 1) && success;
+    success = stack_init(&(search->split_vertices), sizeof(vertex_t)) && success;
+    success = stack_init(&(search->splits), sizeof(vc_component_t)) && success;
+    search->split_depth = 0;
+    search->num_spawned = 0;
+    tt_init(&(search->table), (bitset_index_t) subgraph_base_num_vertices(subgraph), 0);
+    success = stack_init(&(search->frames), sizeof(vc_maxdeg_frame_t)) && success;
+    search->checkpoint = NULL;
+    memset(&(search->stats), 0, sizeof(vc_stats_t));
+    memset(&(search->published), 0, sizeof(vc_stats_t));
+
+    if(!success)
+        vc_search_fail(search, NULL);
+    return success;
+}
+
+/* adds the counters of the search that changed since the last call to the live statistics */
+void vc_search_publish(vc_search_t *search)
+{
+    stats_t *live = search->options->live;
+    uint64_t hits[VC_NUM_RULES];
+
+    if(live == NULL)
+        return;
+
+    for(int i = 0; i < VC_NUM_RULES; i++)
+        hits[i] = search->stats.hits[i] - search->published.hits[i];
+    stats_add(live, search->stats.nodes - search->published.nodes, search->stats.pruned - search->published.pruned, hits);
+    stats_update_depth(live, search->stats.max_depth);
+    search->published = search->stats;
+}
+
+void vc_search_destroy(vc_search_t *search)
+{
+    vc_search_publish(search);
+    lb_destroy(&(search->bound));
+    stack_destroy(&(search->tree_stack));
+    subgraph_destroy(&(search->remaining));
+    if((search->options->kernel != VC_KERNEL_NONE) && (search->options->rekernel > 0))
+        kernel_destroy(&(search->kernel));
+    free(search->marks);
+    free(search->counts);
+    stack_destroy(&(search->touched));
+    stack_destroy(&(search->neighbors));
+    stack_destroy(&(search->split_vertices));
+    stack_destroy(&(search->splits));
+    tt_destroy(&(search->table));
+    stack_destroy(&(search->frames));
+}
+
+/* starts a new set of flags, so that no vertex is flagged, returns the value of flagged entries */
+uint32_t vc_search_next_stamp(vc_search_t *search, const subgraph_t const *subgraph)
+{
+    search->stamp++;
+    if(search->stamp == 0)
+    {
+        /* flags of earlier uses might match again */
+        memset(search->marks, 0, sizeof(uint32_t) * subgraph_base_num_vertices(subgraph));
+        search->stamp = 1;
+    }
+
+    return search->stamp;
+}
+
+void vc_stats_add(vc_stats_t *stats, const vc_stats_t const *source)
+{
+    if(stats)
+    {
+        stats->nodes += source->nodes;
+        stats->pruned += source->pruned;
+        for(int i = 0; i < VC_NUM_RULES; i++)
+            stats->hits[i] += source->hits[i];
+        stats->table_hits += source->table_hits;
+        stats->table_misses += source->table_misses;
+        stats->table_evictions += source->table_evictions;
+        if(source->max_depth > stats->max_depth)
+            stats->max_depth = source->max_depth;
+        stats->expired |= source->expired;
+        stats->failed |= source->failed;
+    }
+}
+
+/* number of search nodes between two checks of the deadline, the live statistics are updated as often */
+#define VC_DEADLINE_INTERVAL 64
+
+/* checks the deadline of the options every few nodes, aborts the pool of 'worker' once it passed */
+bool vc_search_expired(vc_search_t *search, tpool_worker_t *worker)
+{
+    const struct timespec *deadline = &(search->options->deadline);
+    struct timespec now;
+
+    if(search->stats.expired)
+    {
+        /* a rule that ran out of memory could not stop the other workers */
+        if(worker && search->stats.failed)
+            tpool_abort(worker->pool);
+        return true;
+    }
+    if(search->stats.nodes % VC_DEADLINE_INTERVAL != 0)
+        return false;
+
+    vc_search_publish(search);
+    if(deadline->tv_sec == 0)
+        return false;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if((now.tv_sec < deadline->tv_sec) || ((now.tv_sec == deadline->tv_sec) && (now.tv_nsec < deadline->tv_nsec)))
+        return false;
+
+    search->stats.expired = true;
+    if(worker)
+        tpool_abort(worker->pool);
+    return true;
+}
+
+/* returns true if the lower bound shows that 'subgraph' has no vc of size 'k' */
+bool vc_search_prune(vc_search_t *search, const subgraph_t const *subgraph, int k)
+{
+    if(search->options->bound == LB_NONE)
+        return false;
+
+    if(lb_compute(&(search->bound), subgraph, k) > k)
+    {
+        search->stats.pruned++;
+        return true;
+    }
+
+    return false;
+}
+
+/* allocates the frames of vc_maxdeg_search up front: every node takes at least one vertex, so a search with budget 'k' needs at most k + 1 of them outside of splits */
+void vc_search_reserve(vc_search_t *search, const subgraph_t const *subgraph, int k)
+{
+    uint32_t depth = subgraph_base_num_vertices(subgraph);
+
+    if((k >= 0) && ((uint32_t) k < depth))
+        depth = (uint32_t) k;
+    stack_reserve(&(search->frames), depth + 1);
+}
+
+/* gives the search a transposition table of 'bytes' bytes. the vertex set only determines the graph if no edges are added, so the table stays disabled for graphs with overlay. returns false if memory ran out */
+bool vc_search_enable_table(vc_search_t *search, const subgraph_t const *subgraph, uint64_t bytes)
+{
+    if(subgraph_has_overlay(subgraph))
+        return true;
+
+    tt_destroy(&(search->table));
+    if(!tt_init(&(search->table), (bitset_index_t) subgraph_base_num_vertices(subgraph), bytes))
+    {
+        vc_search_fail(search, NULL);
+        return false;
+    }
+    return true;
+}
+
+/* returns true if the transposition table knows that 'subgraph' has no vc of size 'k', stores the hash of its vertices in 'hash' */
+bool vc_search_lookup(vc_search_t *search, const subgraph_t const *subgraph, int k, uint64_t *hash)
+{
+    if(!tt_is_enabled(&(search->table)))
+        return false;
+
+    *hash = bitset_hash(&(subgraph->vertices));
+    if(tt_lookup(&(search->table), &(subgraph->vertices), *hash, (uint32_t) k))
+    {
+        search->stats.table_hits++;
+        return true;
+    }
+
+    search->stats.table_misses++;
+    return false;
+}
+
+/* stores that 'subgraph' has no vc of size 'k', 'hash' was computed by vc_search_lookup */
+void vc_search_remember(vc_search_t *search, const subgraph_t const *subgraph, int k, uint64_t hash)
+{
+    if(tt_is_enabled(&(search->table)) && tt_insert(&(search->table), &(subgraph->vertices), hash, (uint32_t) k))
+        search->stats.table_evictions++;
+}
+
+/* folding rule: a degree-2 vertex whose neighbors are not adjacent is contracted with them into a single vertex, which saves exactly one vertex of the vc. returns false if memory ran out while merging, the changes are still recorded on the trail */
+bool vc_fold_vertex(subgraph_t *subgraph, vertex_t vertex, vertex_t neighbor1, vertex_t neighbor2, stack_t *cover)
+{
+#ifdef VC_DEGREE2_DEBUG
+    fprintf(stdout, "[debug] degree-2 vertex %u is folded into %u\n", vertex, neighbor1);
+#endif
+    /* the merged vertex stands for both neighbors if it is in the vc */
+    vc_cover_add_record(cover, &vertex, &neighbor2, 1, &neighbor1, 1);
+    subgraph_remove_vertex(subgraph, vertex);
+    return subgraph_merge_vertices(subgraph, neighbor1, neighbor2);
+}
+
+/* removes the degree-2 vertex 'vertex' by the triangle or the folding rule, returns the decrease of k */
+int vc_reduce_degree2(vc_search_t *search, subgraph_t *subgraph, vertex_t vertex, stack_t *cover)
+{
+    vertex_t neighbor1, neighbor2;
+
+    if(vc_is_triangle(subgraph, vertex, &neighbor1, &neighbor2))
+    {
+        vc_take_triangle(subgraph, vertex, neighbor1, neighbor2, cover);
+        return 2;
+    }
+
+    if(!vc_fold_vertex(subgraph, vertex, neighbor1, neighbor2, cover))
+        vc_search_fail(search, NULL);
+    search->stats.hits[VC_RULE_FOLD]++;
+    return 1;
+}
+
+/* returns true if N[u] is a subset of N[v] for the neighbor 'v' of 'u', the closed neighborhood of 'u' must be flagged */
+bool vc_is_dominated(const vc_search_t const *search, const subgraph_t const *subgraph, vertex_t u, vertex_t v)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+    uint32_t missing;
+
+    if(subgraph_degree(subgraph, v) < subgraph_degree(subgraph, u))
+        return false;
+
+    /* v may have this many neighbors outside of N[u] */
+    missing = subgraph_degree(subgraph, v) - subgraph_degree(subgraph, u);
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, v);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+    {
+        if(search->marks[neighbor] != search->stamp)
+        {
+            if(missing == 0)
+                return false;
+            missing--;
+        }
+    }
+
+    return true;
+}
+
+/* domination rule: if N[u] is a subset of N[v] for a neighbor v of u, some minimum vc contains v. takes the dominating vertices that are found by one sweep over all vertices, stops once 'budget' is used up (no limit if negative), returns the number of vertices that were added to the vc */
+int vc_take_dominating(vc_search_t *search, subgraph_t *subgraph, int budget, stack_t *cover)
+{
+    subgraph_iter_t iter_vertices, iter_neighborhood;
+    vertex_t u, v;
+    int taken = 0;
+
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(((budget < 0) || (taken < budget)) && subgraph_iter_next(subgraph, &iter_vertices, &u))
+    {
+        if(!subgraph_contains_vertex(subgraph, u))
+            continue;
+
+        /* flag N[u] once, so that every test costs O(deg(v)) */
+        search->marks[u] = vc_search_next_stamp(search, subgraph);
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, u);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &v))
+            search->marks[v] = search->stamp;
+
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, u);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &v))
+        {
+            if(vc_is_dominated(search, subgraph, u, v))
+            {
+                vc_cover_add(cover, v);
+                subgraph_remove_vertex(subgraph, v);
+                search->stats.hits[VC_RULE_DOMINATION]++;
+                taken++;
+                /* N[u] changed, 'u' is tested again by the next sweep */
+                break;
+            }
+        }
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return taken;
+}
+
+/* looks for a vertex of degree 3 with the same neighbors as 'vertex', which must have degree 3, and stores the neighbors in 'neighbors' */
+bool vc_find_twin(vc_search_t *search, const subgraph_t const *subgraph, vertex_t vertex, vertex_t *neighbors, vertex_t *twin)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t candidate, neighbor;
+    uint32_t stamp = vc_search_next_stamp(search, subgraph);
+    int i = 0;
+
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+    {
+        neighbors[i++] = neighbor;
+        search->marks[neighbor] = stamp;
+    }
+
+    /* every twin is a neighbor of the first neighbor */
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, neighbors[0]);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &candidate))
+    {
+        subgraph_iter_t iter_candidate;
+        int shared = 0;
+
+        if((candidate == vertex) || (subgraph_degree(subgraph, candidate) != 3))
+            continue;
+
+        subgraph_iter_neighborhood(subgraph, &iter_candidate, candidate);
+        while(subgraph_iter_next(subgraph, &iter_candidate, &neighbor))
+            shared += (search->marks[neighbor] == stamp);
+
+        if(shared == 3)
+        {
+            *twin = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* twin rule: two vertices of degree 3 with the same neighbors. if the neighbors are adjacent, some minimum vc contains all three of them. otherwise the twins and their neighbors are contracted into a single vertex if the graph allows merging, which saves two vertices of the vc. returns the decrease of k */
+int vc_reduce_twins(vc_search_t *search, subgraph_t *subgraph, stack_t *cover)
+{
+    subgraph_iter_t iter_vertices;
+    vertex_t vertex, twin, neighbors[3], twins[2];
+    bool found = false;
+
+    if(subgraph_has_buckets(subgraph))
+    {
+        bool more = subgraph_first_of_degree(subgraph, 3, &vertex);
+
+        while(!found && more)
+        {
+            found = vc_find_twin(search, subgraph, vertex, neighbors, &twin);
+            if(!found)
+                more = subgraph_next_of_degree(subgraph, &vertex);
+        }
+    }
+    else
+    {
+        subgraph_iter_all_vertices(subgraph, &iter_vertices);
+        while(!found && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+        {
+            if(subgraph_degree(subgraph, vertex) == 3)
+                found = vc_find_twin(search, subgraph, vertex, neighbors, &twin);
+        }
+        subgraph_iter_destroy(&iter_vertices);
+    }
+
+    if(!found)
+        return 0;
+
+    if(subgraph_is_adjacent(subgraph, neighbors[0], neighbors[1]) || subgraph_is_adjacent(subgraph, neighbors[0], neighbors[2]) || subgraph_is_adjacent(subgraph, neighbors[1], neighbors[2]))
+    {
+        for(int i = 0; i < 3; i++)
+        {
+            vc_cover_add(cover, neighbors[i]);
+            subgraph_remove_vertex(subgraph, neighbors[i]);
+        }
+        search->stats.hits[VC_RULE_TWIN]++;
+        return 3;
+    }
+
+    if(!subgraph_has_overlay(subgraph))
+        return 0;
+
+    /* the merged vertex stands for all three neighbors if it is in the vc */
+    twins[0] = vertex;
+    twins[1] = twin;
+    vc_cover_add_record(cover, twins, neighbors + 1, 2, neighbors, 1);
+    subgraph_remove_vertex(subgraph, vertex);
+    subgraph_remove_vertex(subgraph, twin);
+    if(!subgraph_merge_vertices(subgraph, neighbors[0], neighbors[1]) || !subgraph_merge_vertices(subgraph, neighbors[0], neighbors[2]))
+        vc_search_fail(search, NULL);
+    search->stats.hits[VC_RULE_TWIN]++;
+    return 2;
+}
+
+/* returns true if 'vertex' is unconfined: S = {vertex} is extended by the only vertex of N(u) \ N[S] for a vertex u of N(S) with exactly one neighbor in S, which has the fewest neighbors outside of N[S], until there is none (confined) or N(u) \ N[S] is empty (unconfined) */
+bool vc_is_unconfined(vc_search_t *search, const subgraph_t const *subgraph, vertex_t vertex)
+{
+    subgraph_iter_t iter_neighborhood;
+    uint32_t stamp = vc_search_next_stamp(search, subgraph);
+    uint32_t fewest = UINT32_MAX;
+    vertex_t member = vertex, neighbor;
+    bool extended = true;
+
+    /* S is flagged, 'counts' holds the number of neighbors in S for every vertex of N(S), which are collected in 'touched' */
+    while(extended)
+    {
+        search->marks[member] = stamp;
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, member);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if(search->counts[neighbor]++ == 0)
+                stack_push(&(search->touched), &neighbor);
+        }
+
+        fewest = UINT32_MAX;
+        for(uint32_t i = 0; (fewest > 0) && (i < stack_height(&(search->touched))); i++)
+        {
+            vertex_t u = *((vertex_t *) stack_get_element_ptr(&(search->touched), i));
+            vertex_t outside = vertex;
+            uint32_t num_outside = 0;
+
+            if(search->counts[u] != 1)
+                continue;
+
+            subgraph_iter_neighborhood(subgraph, &iter_neighborhood, u);
+            while((num_outside < fewest) && subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+            {
+                if((search->marks[neighbor] != stamp) && (search->counts[neighbor] == 0))
+                {
+                    outside = neighbor;
+                    num_outside++;
+                }
+            }
+
+            if(num_outside < fewest)
+            {
+                fewest = num_outside;
+                member = outside;
+            }
+        }
+
+        /* S only grows by a single vertex, which is not in N(S), so S stays independent */
+        extended = (fewest == 1);
+    }
+
+    while(stack_pop(&(search->touched), &neighbor))
+        search->counts[neighbor] = 0;
+
+    return (fewest == 0);
+}
+
+/* unconfined rule: some minimum vc contains every unconfined vertex, the domination rule is a special case. takes the unconfined vertices that are found by one sweep over all vertices, stops once 'budget' is used up (no limit if negative), returns the number of vertices that were added to the vc */
+int vc_take_unconfined(vc_search_t *search, subgraph_t *subgraph, int budget, stack_t *cover)
+{
+    subgraph_iter_t iter_vertices;
+    vertex_t vertex;
+    int taken = 0;
+
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(((budget < 0) || (taken < budget)) && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+    {
+        if(!subgraph_contains_vertex(subgraph, vertex) || (subgraph_degree(subgraph, vertex) == 0))
+            continue;
+
+        if(vc_is_unconfined(search, subgraph, vertex))
+        {
+            vc_cover_add(cover, vertex);
+            subgraph_remove_vertex(subgraph, vertex);
+            search->stats.hits[VC_RULE_UNCONFINED]++;
+            taken++;
+        }
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return taken;
+}
+
+/* looks for a neighbor 'out' of 'vertex' that has no neighbor in N(vertex), such that N(vertex) \ {out} is a clique */
+bool vc_find_funnel(vc_search_t *search, const subgraph_t const *subgraph, vertex_t vertex, vertex_t *out)
+{
+    subgraph_iter_t iter_neighborhood, iter_inner;
+    vertex_t neighbor, inner;
+    uint32_t stamp = vc_search_next_stamp(search, subgraph);
+    uint32_t degree = subgraph_degree(subgraph, vertex);
+    uint64_t inner_edges = 0;
+    bool found = false;
+
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        search->marks[neighbor] = stamp;
+
+    /* the clique has (degree - 1) * (degree - 2) / 2 edges, all edges inside of N(vertex) */
+    subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+    {
+        uint32_t num_inner = 0;
+
+        subgraph_iter_neighborhood(subgraph, &iter_inner, neighbor);
+        while(subgraph_iter_next(subgraph, &iter_inner, &inner))
+            num_inner += (search->marks[inner] == stamp);
+
+        if(num_inner == 0)
+        {
+            *out = neighbor;
+            found = true;
+        }
+        else if(num_inner != degree - 2)
+            return false;
+        inner_edges += num_inner;
+    }
+
+    return found && (inner_edges == (uint64_t) (degree - 1) * (degree - 2));
+}
+
+/* funnel rule: if N(v) \ {u} is a clique for a neighbor u of v without common neighbors, some minimum vc contains exactly one of u and v. both are removed and every remaining neighbor of v is joined with every remaining neighbor of u, which saves one vertex of the vc. funnels that would add more edges than they remove are skipped. applies the funnels that are found by one sweep over all vertices, stops once 'budget' is used up (no limit if negative), returns the decrease of k */
+int vc_reduce_funnels(vc_search_t *search, subgraph_t *subgraph, int budget, stack_t *cover)
+{
+    subgraph_iter_t iter_vertices, iter_neighborhood;
+    vertex_t vertex, out, neighbor;
+    int taken = 0;
+
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(((budget < 0) || (taken < budget)) && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+    {
+        uint64_t degree, out_degree;
+
+        if(!subgraph_contains_vertex(subgraph, vertex) || (subgraph_degree(subgraph, vertex) < 2))
+            continue;
+        if(!vc_find_funnel(search, subgraph, vertex, &out))
+            continue;
+
+        degree = subgraph_degree(subgraph, vertex);
+        out_degree = subgraph_degree(subgraph, out);
+        if((degree - 1) * (out_degree - 1) > degree + out_degree - 1)
+            continue;
+
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if(neighbor != out)
+                stack_push(&(search->touched), &neighbor);
+        }
+
+        /* 'out' is in the vc if all other neighbors of 'vertex' are */
+        vc_cover_add_record(cover, &vertex, &out, 1, (vertex_t *) stack_get_element_ptr(&(search->touched), 0), stack_height(&(search->touched)));
+        subgraph_remove_vertex(subgraph, vertex);
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, out);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            for(uint32_t i = 0; i < stack_height(&(search->touched)); i++)
+            {
+                vertex_t clique_vertex = *((vertex_t *) stack_get_element_ptr(&(search->touched), i));
+
+                if(!subgraph_is_adjacent(subgraph, clique_vertex, neighbor) && !subgraph_add_edge(subgraph, clique_vertex, neighbor))
+                    vc_search_fail(search, NULL);
+            }
+        }
+        subgraph_remove_vertex(subgraph, out);
+        while(!stack_isempty(&(search->touched)))
+            stack_remove_last(&(search->touched));
+
+        search->stats.hits[VC_RULE_FUNNEL]++;
+        taken++;
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return taken;
+}
+
+/* collects N(x) | N(y) without 'excluded1' and 'excluded2' into 'side', returns false if it has more than two vertices */
+bool vc_desk_side(vc_search_t *search, const subgraph_t const *subgraph, vertex_t x, vertex_t y, vertex_t excluded1, vertex_t excluded2, vertex_t *side, uint32_t *size)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t ends[2] = { x, y }, neighbor;
+
+    *size = 0;
+    vc_search_next_stamp(search, subgraph);
+    for(int i = 0; i < 2; i++)
+    {
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, ends[i]);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            if((neighbor == excluded1) || (neighbor == excluded2) || (search->marks[neighbor] == search->stamp))
+                continue;
+            if(*size == 2)
+                return false;
+            search->marks[neighbor] = search->stamp;
+            side[(*size)++] = neighbor;
+        }
+    }
+
+    return true;
+}
+
+bool vc_sides_disjoint(const vertex_t const *side, const uint32_t const *side_size)
+{
+    for(uint32_t i = 0; i < side_size[0]; i++)
+    {
+        for(uint32_t j = 0; j < side_size[1]; j++)
+        {
+            if(side[i] == side[2 + j])
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* looks for a chordless 4-cycle 'cycle' starting at 'vertex' whose vertices have degree 3 or 4, such that the neighbors of the opposite pairs outside of the cycle are disjoint sets 'side' of at most two vertices each */
+bool vc_find_desk(vc_search_t *search, const subgraph_t const *subgraph, vertex_t vertex, vertex_t *cycle, vertex_t *side, uint32_t *side_size)
+{
+    subgraph_iter_t iter_b, iter_c, iter_d;
+    vertex_t a = vertex, b, c, d;
+
+    subgraph_iter_neighborhood(subgraph, &iter_b, a);
+    while(subgraph_iter_next(subgraph, &iter_b, &b))
+    {
+        if((subgraph_degree(subgraph, b) < 3) || (subgraph_degree(subgraph, b) > 4))
+            continue;
+
+        subgraph_iter_neighborhood(subgraph, &iter_c, b);
+        while(subgraph_iter_next(subgraph, &iter_c, &c))
+        {
+            if((c == a) || (subgraph_degree(subgraph, c) < 3) || (subgraph_degree(subgraph, c) > 4) || subgraph_is_adjacent(subgraph, a, c))
+                continue;
+
+            subgraph_iter_neighborhood(subgraph, &iter_d, c);
+            while(subgraph_iter_next(subgraph, &iter_d, &d))
+            {
+                if((d == b) || (subgraph_degree(subgraph, d) < 3) || (subgraph_degree(subgraph, d) > 4))
+                    continue;
+                if(!subgraph_is_adjacent(subgraph, a, d) || subgraph_is_adjacent(subgraph, b, d))
+                    continue;
+
+                if(!vc_desk_side(search, subgraph, a, c, b, d, side, &side_size[0]) || !vc_desk_side(search, subgraph, b, d, a, c, side + 2, &side_size[1]))
+                    continue;
+                if(vc_sides_disjoint(side, side_size))
+                {
+                    cycle[0] = a;
+                    cycle[1] = c;
+                    cycle[2] = b;
+                    cycle[3] = d;
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/* desk rule: a desk is a chordless 4-cycle a, b, c, d of vertices of degree 3 or 4, such that A = N({a, c}) \ {b, d} and B = N({b, d}) \ {a, c} are disjoint and have at most two vertices each. some minimum vc contains either a and c or b and d, so the cycle is removed and A is joined with B, which saves two vertices of the vc. applies the desks that are found by one sweep over all vertices, stops once 'budget' is used up (no limit if negative), returns the decrease of k */
+int vc_reduce_desks(vc_search_t *search, subgraph_t *subgraph, int budget, stack_t *cover)
+{
+    subgraph_iter_t iter_vertices;
+    vertex_t vertex, cycle[4], side[4];
+    uint32_t side_size[2];
+    int taken = 0;
+
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(((budget < 0) || (taken < budget)) && subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+    {
+        if(!subgraph_contains_vertex(subgraph, vertex) || (subgraph_degree(subgraph, vertex) < 3) || (subgraph_degree(subgraph, vertex) > 4))
+            continue;
+        if(!vc_find_desk(search, subgraph, vertex, cycle, side, side_size))
+            continue;
+
+        /* b and d are in the vc if all of A is */
+        vc_cover_add_record(cover, cycle, cycle + 2, 2, side, side_size[0]);
+        for(int i = 0; i < 4; i++)
+            subgraph_remove_vertex(subgraph, cycle[i]);
+        for(uint32_t i = 0; i < side_size[0]; i++)
+        {
+            for(uint32_t j = 0; j < side_size[1]; j++)
+            {
+                if(!subgraph_is_adjacent(subgraph, side[i], side[2 + j]) && !subgraph_add_edge(subgraph, side[i], side[2 + j]))
+                    vc_search_fail(search, NULL);
+            }
+        }
+
+        search->stats.hits[VC_RULE_DESK]++;
+        taken += 2;
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return taken;
+}
+
+/* applies the enabled rules that are only tried once the degree rules are exhausted, returns the decrease of k */
+int vc_apply_rules(vc_search_t *search, subgraph_t *subgraph, int budget, stack_t *cover)
+{
+    int taken = 0;
+
+    if(vc_rule_enabled(search->options, VC_RULE_TWIN))
+        taken = vc_reduce_twins(search, subgraph, cover);
+    if((taken == 0) && vc_rule_enabled(search->options, VC_RULE_DOMINATION))
+        taken = vc_take_dominating(search, subgraph, budget, cover);
+    if((taken == 0) && vc_rule_enabled(search->options, VC_RULE_FUNNEL) && subgraph_has_overlay(subgraph))
+        taken = vc_reduce_funnels(search, subgraph, budget, cover);
+    if((taken == 0) && vc_rule_enabled(search->options, VC_RULE_DESK) && subgraph_has_overlay(subgraph))
+        taken = vc_reduce_desks(search, subgraph, budget, cover);
+    if((taken == 0) && vc_rule_enabled(search->options, VC_RULE_UNCONFINED))
+        taken = vc_take_unconfined(search, subgraph, budget, cover);
+
+    return taken;
+}
+
+void vc_buss_kernel(vc_search_t *search, subgraph_t *subgraph, int *k, stack_t *cover)
+{
+    vertex_t maxvertex, minvertex;
+    int maxdeg, mindeg;
+
+    while((*k > 0) && find_minmaxdeg_vertex(subgraph, &maxvertex, &maxdeg, &minvertex, &mindeg))
+    {
+        if(mindeg == 1)
+        {
+            vc_take_degree1_neighbor(subgraph, minvertex, cover);
+            (*k)--;
+        }
+        else if(maxdeg > *k)
+        {
+            vc_cover_add(cover, maxvertex);
+            subgraph_remove_vertex(subgraph, maxvertex);
+            (*k)--;
+        }
+        else if((mindeg == 2) && vc_rule_enabled(search->options, VC_RULE_FOLD))
+            (*k) = (*k) - vc_reduce_degree2(search, subgraph, minvertex, cover);
+        else
+        {
+            int taken = 0;
+
+            if(mindeg == 2)
+                taken = vc_take_triangles(subgraph, *k, cover);
+            if(taken == 0)
+                taken = vc_apply_rules(search, subgraph, *k, cover);
+            if(taken == 0)
+                break;
+            (*k) = (*k) - taken;
+        }
+    }
+}
+
+/* applies the rules of vc_buss_kernel that do not depend on k, returns the decrease of k (the number of vertices that are added to the vc once it is unfolded) */
+int vc_static_kernel(vc_search_t *search, subgraph_t *subgraph, stack_t *cover)
+{
+    vertex_t maxvertex, minvertex;
+    int maxdeg, mindeg, taken = 0;
+
+    while(find_minmaxdeg_vertex(subgraph, &maxvertex, &maxdeg, &minvertex, &mindeg))
+    {
+        if(mindeg == 1)
+        {
+            vc_take_degree1_neighbor(subgraph, minvertex, cover);
+            taken++;
+        }
+        else if((mindeg == 2) && vc_rule_enabled(search->options, VC_RULE_FOLD))
+            taken = taken + vc_reduce_degree2(search, subgraph, minvertex, cover);
+        else
+        {
+            int reduced = 0;
+
+            if(mindeg == 2)
+                reduced = vc_take_triangles(subgraph, -1, cover);
+            if(reduced == 0)
+                reduced = vc_apply_rules(search, subgraph, -1, cover);
+            if(reduced == 0)
+                break;
+            taken = taken + reduced;
+        }
+    }
+
+    return taken;
+}
+
+/* applies the selected LP kernel once, returns the number of vertices that were added to the vc */
+int vc_apply_kernel(vc_kernel_t type, kernel_t *kernel, subgraph_t *subgraph, stack_t *cover)
+{
+    switch(type)
+    {
+        case VC_KERNEL_NONE:
+            return 0;
+        case VC_KERNEL_CROWN:
+            return kernel_crown(kernel, subgraph, cover);
+        case VC_KERNEL_NT:
+            return kernel_nt(kernel, subgraph, cover);
+    }
+
+    return 0;
+}
+
+/* applies the k-independent reductions until none of them changes the graph, returns the number of vertices that were added to the vc */
+int vc_preprocess(vc_search_t *search, subgraph_t *subgraph, stack_t *cover)
+{
+    const vc_options_t *options = search->options;
+    kernel_t kernel;
+    uint32_t num_vertices;
+    int taken = 0;
+
+    if(options->kernel == VC_KERNEL_NONE)
+        return 0;
+
+    if(!subgraph_enable_buckets(subgraph))
+    {
+        vc_search_fail(search, NULL);
+        return 0;
+    }
+    if(!kernel_init(&kernel, subgraph_get_base_graph(subgraph)))
+    {
+        kernel_destroy(&kernel);
+        vc_search_fail(search, NULL);
+        return 0;
+    }
+    do
+    {
+        num_vertices = subgraph_num_vertices(subgraph);
+        taken += vc_static_kernel(search, subgraph, cover);
+        taken += vc_apply_kernel(options->kernel, &kernel, subgraph, cover);
+    }
+    while(subgraph_num_vertices(subgraph) < num_vertices);
+    kernel_destroy(&kernel);
+
+    if(options->verbose)
+        fprintf(stdout, "[info] preprocessing took %i vertices, %u vertices are left\n", taken, subgraph_num_vertices(subgraph));
+    return taken;
+}
+
+/* applies the LP kernel inside the search once the graph shrank enough, returns false if the rest of the graph has no vc of size 'k' */
+bool vc_search_rekernel(vc_search_t *search, subgraph_t *subgraph, int *k, stack_t *cover)
+{
+    if((search->options->kernel == VC_KERNEL_NONE) || (search->options->rekernel == 0))
+        return true;
+
+    if(100 * (uint64_t) subgraph_num_vertices(subgraph) > (uint64_t) search->options->rekernel * search->kernel_size)
+        return true;
+
+    *k -= vc_apply_kernel(search->options->kernel, &(search->kernel), subgraph, cover);
+    search->kernel_size = subgraph_num_vertices(subgraph);
+
+    /* the vertices that are left by Nemhauser-Trotter need at least half of them in a vc */
+    if(search->options->kernel == VC_KERNEL_NT)
+        return (*k >= 0) && (subgraph_num_vertices(subgraph) <= 2 * (uint32_t) *k);
+    return (*k >= 0);
+}
+
+void vc_maxdeg_parallel_discard(tpool_worker_t *worker, void *data)
+{
+    vc_maxdeg_task_t *task = (vc_maxdeg_task_t *) data;
+    vc_maxdeg_parallel_t *search = (vc_maxdeg_parallel_t *) worker->pool->context;
+
+    subgraph_destroy(&(task->graph));
+    if(search->cover)
+        stack_destroy(&(task->cover));
+}
+
+/* returns true if N(vertex) \ N(candidate) is a clique, 'neighbors' holds N(vertex) and 'counts' the number of common neighbors of 'candidate' */
+bool vc_is_mirror(vc_search_t *search, const subgraph_t const *graph, vertex_t candidate, const vertex_t const *neighbors, uint32_t degree)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor;
+    uint32_t stamp;
+
+    if(degree - search->counts[candidate] <= 1)
+        return true;
+
+    stamp = vc_search_next_stamp(search, graph);
+    subgraph_iter_neighborhood(graph, &iter_neighborhood, candidate);
+    while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+        search->marks[neighbor] = stamp;
+
+    for(uint32_t i = 0; i < degree; i++)
+    {
+        if(search->marks[neighbors[i]] == stamp)
+            continue;
+
+        for(uint32_t j = i + 1; j < degree; j++)
+        {
+            if((search->marks[neighbors[j]] != stamp) && !subgraph_is_adjacent(graph, neighbors[i], neighbors[j]))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* collects the mirrors of 'vertex' in 'touched': vertices u at distance 2 such that N(vertex) \ N(u) is a clique. some minimum vc contains all of N(vertex), or 'vertex' together with all of its mirrors */
+void vc_find_mirrors(vc_search_t *search, const subgraph_t const *graph, vertex_t vertex)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor, candidate, *neighbors;
+    uint32_t stamp = vc_search_next_stamp(search, graph);
+    uint32_t degree = subgraph_degree(graph, vertex), num_mirrors = 0;
+
+    search->marks[vertex] = stamp;
+    subgraph_iter_neighborhood(graph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+    {
+        search->marks[neighbor] = stamp;
+        stack_push(&(search->neighbors), &neighbor);
+    }
+
+    /* every vertex at distance 2 is a candidate, 'counts' holds its number of common neighbors with 'vertex' */
+    neighbors = (vertex_t *) stack_get_element_ptr(&(search->neighbors), 0);
+    for(uint32_t i = 0; i < degree; i++)
+    {
+        subgraph_iter_neighborhood(graph, &iter_neighborhood, neighbors[i]);
+        while(subgraph_iter_next(graph, &iter_neighborhood, &candidate))
+        {
+            if((search->marks[candidate] != stamp) && (search->counts[candidate]++ == 0))
+                stack_push(&(search->touched), &candidate);
+        }
+    }
+
+    for(uint32_t i = 0; i < stack_height(&(search->touched)); i++)
+    {
+        vertex_t *candidates = (vertex_t *) stack_get_element_ptr(&(search->touched), 0);
+        bool mirror = vc_is_mirror(search, graph, candidates[i], neighbors, degree);
+
+        search->counts[candidates[i]] = 0;
+        if(mirror)
+            candidates[num_mirrors++] = candidates[i];
+    }
+
+    while(stack_height(&(search->touched)) > num_mirrors)
+        stack_remove_last(&(search->touched));
+    while(!stack_isempty(&(search->neighbors)))
+        stack_remove_last(&(search->neighbors));
+}
+
+/* collects the satellites of 'vertex' in 'touched': vertices w such that N[u] \ N[vertex] = {w} for a neighbor u of 'vertex'. some minimum vc contains 'vertex', or neither 'vertex' nor any of its satellites */
+void vc_find_satellites(vc_search_t *search, const subgraph_t const *graph, vertex_t vertex)
+{
+    subgraph_iter_t iter_neighborhood, iter_outside;
+    vertex_t neighbor, outside, satellite;
+    uint32_t stamp = vc_search_next_stamp(search, graph);
+
+    search->marks[vertex] = stamp;
+    subgraph_iter_neighborhood(graph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+        search->marks[neighbor] = stamp;
+
+    subgraph_iter_neighborhood(graph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+    {
+        uint32_t num_outside = 0;
+
+        subgraph_iter_neighborhood(graph, &iter_outside, neighbor);
+        while((num_outside < 2) && subgraph_iter_next(graph, &iter_outside, &outside))
+        {
+            if(search->marks[outside] != stamp)
+            {
+                satellite = outside;
+                num_outside++;
+            }
+        }
+
+        if((num_outside == 1) && (search->counts[satellite]++ == 0))
+            stack_push(&(search->touched), &satellite);
+    }
+
+    for(uint32_t i = 0; i < stack_height(&(search->touched)); i++)
+        search->counts[*((vertex_t *) stack_get_element_ptr(&(search->touched), i))] = 0;
+}
+
+/* first branch: takes 'vertex' and the mirrors in 'touched', see vc_find_mirrors. returns the number of vertices that were taken */
+int vc_branch_include(vc_search_t *search, subgraph_t *graph, vertex_t vertex, stack_t *cover)
+{
+    vertex_t mirror;
+    int taken = 1;
+
+    vc_cover_add(cover, vertex);
+    subgraph_remove_vertex(graph, vertex);
+    while(stack_pop(&(search->touched), &mirror))
+    {
+        vc_cover_add(cover, mirror);
+        subgraph_remove_vertex(graph, mirror);
+        taken++;
+    }
+
+    return taken;
+}
+
+/* second branch: 'vertex' is not in the vc, so all of its neighbors are. if 'satellites' is set, neither are the satellites of 'vertex', whose neighbors are taken as well. returns the number of vertices that were taken, -1 if two satellites are adjacent */
+int vc_branch_exclude(vc_search_t *search, subgraph_t *graph, vertex_t vertex, bool satellites, stack_t *cover)
+{
+    subgraph_iter_t iter_neighborhood;
+    vertex_t neighbor, satellite;
+    uint32_t first = stack_height(&(search->touched));
+    int taken = 0;
+
+    if(satellites)
+        vc_find_satellites(search, graph, vertex);
+
+    subgraph_iter_neighborhood(graph, &iter_neighborhood, vertex);
+    while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+    {
+        subgraph_remove_vertex(graph, neighbor);
+        vc_cover_add(cover, neighbor);
+        taken++;
+    }
+    subgraph_iter_destroy(&iter_neighborhood);
+    subgraph_remove_vertex(graph, vertex);
+
+    while(stack_height(&(search->touched)) > first)
+    {
+        stack_pop(&(search->touched), &satellite);
+        /* a satellite that was taken as neighbor of another one cannot be excluded */
+        if(taken < 0)
+            continue;
+        if(!subgraph_contains_vertex(graph, satellite))
+        {
+            taken = -1;
+            continue;
+        }
+
+        subgraph_iter_neighborhood(graph, &iter_neighborhood, satellite);
+        while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+        {
+            subgraph_remove_vertex(graph, neighbor);
+            vc_cover_add(cover, neighbor);
+            taken++;
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+        subgraph_remove_vertex(graph, satellite);
+    }
+
+    return taken;
+}
+
+/* spawns a task for the second branch at 'vertex' on a copy of 'graph', see vc_branch_exclude. returns false if the branch is infeasible */
+bool vc_maxdeg_spawn_exclude(tpool_worker_t *worker, vc_search_t *search, const subgraph_t const *graph, vertex_t vertex, bool satellites, int k, const stack_t const *cover)
+{
+    vc_maxdeg_task_t branch;
+    int taken;
+
+    /* without memory for a copy the branch stays with this worker */
+    if(!subgraph_init_copy(&(branch.graph), graph) || (cover && !stack_init_copy(&(branch.cover), cover)))
+    {
+        subgraph_destroy(&(branch.graph));
+        return false;
+    }
+
+    taken = vc_branch_exclude(search, &(branch.graph), vertex, satellites, cover ? &(branch.cover) : NULL);
+    if((taken < 0) || (taken > k))
+    {
+        subgraph_destroy(&(branch.graph));
+        if(cover)
+            stack_destroy(&(branch.cover));
+        return false;
+    }
+
+    branch.k = k - taken;
+    tpool_spawn(worker, &branch);
+    return true;
+}
+
+/* appends the component of 'root' to 'split_vertices' by a BFS, returns its number of vertices */
+uint32_t vc_search_collect_component(vc_search_t *search, const subgraph_t const *graph, vertex_t root)
+{
+    uint32_t head = stack_height(&(search->split_vertices));
+    uint32_t start = head;
+
+    search->marks[root] = search->stamp;
+    stack_push(&(search->split_vertices), &root);
+    while(head < stack_height(&(search->split_vertices)))
+    {
+        subgraph_iter_t iter_neighborhood;
+        vertex_t vertex = *((vertex_t *) stack_get_element_ptr(&(search->split_vertices), head++));
+        vertex_t neighbor;
+
+        subgraph_iter_neighborhood(graph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(graph, &iter_neighborhood, &neighbor))
+        {
+            if(search->marks[neighbor] != search->stamp)
+            {
+                search->marks[neighbor] = search->stamp;
+                stack_push(&(search->split_vertices), &neighbor);
+            }
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+    }
+
+    return stack_height(&(search->split_vertices)) - start;
+}
+
+int vc_compare_components(const void *a, const void *b)
+{
+    uint32_t size_a = ((const vc_component_t *) a)->size;
+    uint32_t size_b = ((const vc_component_t *) b)->size;
+
+    return (size_a > size_b) - (size_a < size_b);
+}
+
+/* pushes the components of 'graph' onto the split stacks, smallest first, returns false and pushes nothing if 'graph' is connected or memory ran out */
+bool vc_search_split(vc_search_t *search, const subgraph_t const *graph, vertex_t root)
+{
+    uint32_t first = stack_height(&(search->splits));
+    subgraph_iter_t iter_vertices;
+    vc_component_t component;
+    vertex_t vertex;
+
+    /* every vertex is pushed once and starts at most one component, so no push below allocates */
+    if(!stack_grow(&(search->split_vertices), subgraph_num_vertices(graph)) || !stack_grow(&(search->splits), subgraph_num_vertices(graph)))
+        return false;
+
+    vc_search_next_stamp(search, graph);
+    component.start = stack_height(&(search->split_vertices));
+    component.size = vc_search_collect_component(search, graph, root);
+    if(component.size == subgraph_num_vertices(graph))
+    {
+        while(stack_height(&(search->split_vertices)) > component.start)
+            stack_remove_last(&(search->split_vertices));
+        return false;
+    }
+    stack_push(&(search->splits), &component);
+
+    subgraph_iter_all_vertices(graph, &iter_vertices);
+    while(subgraph_iter_next(graph, &iter_vertices, &vertex))
+    {
+        if(search->marks[vertex] != search->stamp)
+        {
+            component.start = stack_height(&(search->split_vertices));
+            component.size = vc_search_collect_component(search, graph, vertex);
+            stack_push(&(search->splits), &component);
+        }
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    qsort(stack_get_element_ptr(&(search->splits), first), stack_height(&(search->splits)) - first, sizeof(vc_component_t), vc_compare_components);
+    return true;
+}
+
+/* removes the split that was pushed last by vc_search_split */
+void vc_search_unsplit(vc_search_t *search, uint32_t first)
+{
+    vc_component_t *component = (vc_component_t *) stack_get_element_ptr(&(search->splits), first);
+    uint32_t start = component->start;
+
+    /* components are sorted by size, so the smallest start belongs to the component of the root */
+    for(uint32_t i = first; i < stack_height(&(search->splits)); i++)
+    {
+        component = (vc_component_t *) stack_get_element_ptr(&(search->splits), i);
+        if(component->start < start)
+            start = component->start;
+    }
+
+    while(stack_height(&(search->splits)) > first)
+        stack_remove_last(&(search->splits));
+    while(stack_height(&(search->split_vertices)) > start)
+        stack_remove_last(&(search->split_vertices));
+}
+
+/* adds or removes all vertices of a component, additions are not recorded on the trail */
+void vc_search_toggle_component(vc_search_t *search, subgraph_t *graph, uint32_t index, bool add)
+{
+    vc_component_t component = *((vc_component_t *) stack_get_element_ptr(&(search->splits), index));
+
+    for(uint32_t i = component.start; i < component.start + component.size; i++)
+    {
+        vertex_t vertex = *((vertex_t *) stack_get_element_ptr(&(search->split_vertices), i));
+
+        if(add)
+            subgraph_add_vertex(graph, vertex);
+        else
+            subgraph_remove_vertex(graph, vertex);
+    }
+}
+
+bool vc_maxdeg_search(subgraph_t *graph, int k, stack_t *cover, vc_search_t *search, tpool_worker_t *worker);
+
+/* returns the size of a minimum vc of 'graph' and adds it to 'cover', or -1 if it is greater than 'limit'; 'graph' is left unchanged */
+int vc_maxdeg_minimum(subgraph_t *graph, int limit, stack_t *cover, vc_search_t *search, tpool_worker_t *worker)
+{
+    uint32_t mark = subgraph_trail_mark(graph);
+    int size = lb_matching(&(search->bound), graph, limit, NULL);
+    int bound = lb_compute(&(search->bound), graph, limit);
+
+    if(bound > size)
+        size = bound;
+
+    for(; size <= limit; size++)
+    {
+        if(vc_maxdeg_search(graph, size, cover, search, worker))
+        {
+            subgraph_trail_rollback(graph, mark);
+            return size;
+        }
+        if((worker && tpool_is_aborted(worker->pool)) || search->stats.expired)
+            break;
+    }
+
+    return -1;
+}
+
+/* solves the components of a disconnected graph one by one, smallest first: all but the largest one are solved exactly, the largest one gets the rest of the budget; returns false if the graph is connected */
+bool vc_maxdeg_components(subgraph_t *graph, int k, stack_t *cover, vc_search_t *search, tpool_worker_t *worker, vertex_t root, bool *solution_found)
+{
+    uint32_t first = stack_height(&(search->splits));
+    uint32_t num_components, i;
+
+    if(!vc_search_split(search, graph, root))
+        return false;
+    num_components = stack_height(&(search->splits)) - first;
+
+    /* only the smallest component is left in the graph, every other one is added back once its predecessors are solved */
+    for(i = num_components; i-- > 1; )
+        vc_search_toggle_component(search, graph, first + i, false);
+
+    search->split_depth++;
+    *solution_found = true;
+    for(i = 0; *solution_found && (i + 1 < num_components); i++)
+    {
+        int size = vc_maxdeg_minimum(graph, k, cover, search, worker);
+
+        if(size < 0)
+            *solution_found = false;
+        else
+        {
+            k -= size;
+            vc_search_toggle_component(search, graph, first + i, false);
+            vc_search_toggle_component(search, graph, first + i + 1, true);
+        }
+    }
+    if(*solution_found)
+        *solution_found = vc_maxdeg_search(graph, k, cover, search, worker);
+    search->split_depth--;
+
+    vc_search_unsplit(search, first);
+    return true;
+}
+
+/* pushes a node with budget 'k' that starts on the current state of 'graph' and 'cover', fails the search if memory runs out */
+void vc_maxdeg_push(vc_search_t *search, const subgraph_t const *graph, const stack_t const *cover, int k)
+{
+    vc_maxdeg_frame_t frame;
+
+    frame.stage = VC_STAGE_ENTER;
+    frame.k = k;
+    frame.mark = subgraph_trail_mark(graph);
+    frame.cover_mark = vc_cover_mark(cover);
+    frame.kernel_mark = frame.mark;
+    frame.kernel_cover_mark = frame.cover_mark;
+    frame.kernel_size = search->kernel_size;
+    frame.num_spawned = search->num_spawned;
+    frame.hash = 0;
+    frame.exhausted = false;
+    frame.spawned = false;
+    frame.satellites = false;
+    if(!stack_push(&(search->frames), &frame))
+    {
+        /* the parent unwinds since the search is expired now */
+        vc_search_fail(search, NULL);
+        return;
+    }
+    if(stack_height(&(search->frames)) > search->stats.max_depth)
+        search->stats.max_depth = stack_height(&(search->frames));
+}
+
+vc_maxdeg_frame_t *vc_maxdeg_top(const vc_search_t const *search)
+{
+    return (vc_maxdeg_frame_t *) stack_get_element_ptr(&(search->frames), stack_height(&(search->frames)) - 1);
+}
+
+/* runs the part of the top node before its first branch: kernel, lower bound and components. returns true if the node branches, the first branch has budget 'child_k' then. otherwise the node is finished with the result 'solution_found' */
+bool vc_maxdeg_expand(subgraph_t *graph, stack_t *cover, vc_search_t *search, tpool_worker_t *worker, bool *solution_found, int *child_k)
+{
+    vc_maxdeg_frame_t *frame = vc_maxdeg_top(search);
+    vertex_t minvertex;
+    int mindeg;
+
+    *solution_found = false;
+    if((worker && tpool_is_aborted(worker->pool)) || vc_search_expired(search, worker))
+        return false;
+    search->stats.nodes++;
+
+    /* kernelization: remove vertices of degree 1 or degree > k */
+    vc_buss_kernel(search, graph, &(frame->k), cover);
+
+    if(!vc_search_rekernel(search, graph, &(frame->k), cover))
+        return false;
+    if(!find_minmaxdeg_vertex(graph, &(frame->vertex), &(frame->maxdeg), &minvertex, &mindeg))
+    {
+        *solution_found = (frame->k >= 0);
+        return false;
+    }
+#ifdef VC_MAXDEG_DEBUG
+    fprintf(stdout, "[debug] found maximum degree vertex: %u has %u neighbors\n", frame->vertex, frame->maxdeg);
+#endif
+    if(frame->k <= 0)
+        return false;
+
+    frame->kernel_mark = subgraph_trail_mark(graph);
+    frame->kernel_cover_mark = vc_cover_mark(cover);
+
+    /* if the graph consists of trees and cycles, we can solve it in polynomial time */
+    if(frame->maxdeg <= 2)
+    {
+        *solution_found = vc_tree_cycle(graph, frame->k, cover);
+        return false;
+    }
+    if(vc_search_lookup(search, graph, frame->k, &(frame->hash)) || vc_search_prune(search, graph, frame->k))
+        return false;
+    if(search->options->components && vc_maxdeg_components(graph, frame->k, cover, search, worker, frame->vertex, solution_found))
+    {
+        /* the components were solved by nested searches on top of this node, which may have moved the frames */
+        frame = vc_maxdeg_top(search);
+        frame->exhausted = (search->num_spawned == frame->num_spawned);
+        return false;
+    }
+
+    /* satellites are only excluded together with a vertex that has no mirrors */
+    if(search->options->branching != VC_BRANCH_MAXDEG)
+    {
+        vc_find_mirrors(search, graph, frame->vertex);
+        frame->satellites = (search->options->branching == VC_BRANCH_SATELLITE) && stack_isempty(&(search->touched));
+    }
+
+    /* the second branch only needs a copy if another worker is waiting for it */
+    if(worker && (search->split_depth == 0) && (frame->maxdeg <= frame->k) && (tpool_num_idle(worker->pool) > 0) && (tpool_num_queued(worker) == 0))
+    {
+        frame->spawned = vc_maxdeg_spawn_exclude(worker, search, graph, frame->vertex, frame->satellites, frame->k, cover);
+        search->num_spawned += frame->spawned;
+    }
+
+    /* first branch: include 'vertex' and its mirrors */
+    *child_k = frame->k - vc_branch_include(search, graph, frame->vertex, cover);
+    frame->stage = VC_STAGE_FIRST;
+    return true;
+}
+
+/* starts the second branch of the top node once its first one failed, returns false if there is none */
+bool vc_maxdeg_second(subgraph_t *graph, stack_t *cover, vc_search_t *search, int *child_k)
+{
+    vc_maxdeg_frame_t *frame = vc_maxdeg_top(search);
+    int taken;
+
+    if(frame->spawned || (frame->maxdeg > frame->k))
+        return false;
+
+    /* second branch: include the neighborhood of 'vertex' and of its satellites */
+    subgraph_trail_rollback(graph, frame->kernel_mark);
+    vc_cover_restore(cover, frame->kernel_cover_mark);
+    taken = vc_branch_exclude(search, graph, frame->vertex, frame->satellites, cover);
+    if((taken < 0) || (taken > frame->k))
+        return false;
+
+    *child_k = frame->k - taken;
+    frame->stage = VC_STAGE_SECOND;
+    return true;
+}
+
+/* finishes the top node: a node without vc undoes its changes and remembers its graph in the transposition table */
+void vc_maxdeg_pop(subgraph_t *graph, stack_t *cover, vc_search_t *search, tpool_worker_t *worker, bool solution_found)
+{
+    vc_maxdeg_frame_t frame;
+
+    stack_pop(&(search->frames), &frame);
+    if(!solution_found)
+    {
+        /* an aborted or expired search or a spawned branch did not show that there is no vc */
+        if(frame.exhausted && !search->stats.expired && !(worker && tpool_is_aborted(worker->pool)))
+        {
+            subgraph_trail_rollback(graph, frame.kernel_mark);
+            vc_search_remember(search, graph, frame.k, frame.hash);
+        }
+        subgraph_trail_rollback(graph, frame.mark);
+        vc_cover_restore(cover, frame.cover_mark);
+    }
+
+    search->kernel_size = frame.kernel_size;
+}
+
+/* branches on a vertex of maximum degree, see vc_branch_include and vc_branch_exclude. the nodes are kept on the explicit stack 'frames' of the search, whose depth is bounded by k since every branch takes a vertex. all changes are done on 'graph' and undone on the way back, so no node needs a copy. if 'worker' is set, the second branch is handed to idle workers */
+bool vc_maxdeg_search(subgraph_t *graph, int k, stack_t *cover, vc_search_t *search, tpool_worker_t *worker)
+{
+    uint32_t base = stack_height(&(search->frames));
+    bool solution_found = false;
+    int child_k;
+
+    vc_maxdeg_push(search, graph, cover, k);
+    while(stack_height(&(search->frames)) > base)
+    {
+        vc_maxdeg_frame_t *frame = vc_maxdeg_top(search);
+        bool branches = false;
+
+        /* 'solution_found' holds the result of the branch that returned to this node */
+        switch(frame->stage)
+        {
+            case VC_STAGE_ENTER:
+                branches = vc_maxdeg_expand(graph, cover, search, worker, &solution_found, &child_k);
+                break;
+            case VC_STAGE_FIRST:
+                /* a found vc ends all ancestors, an aborted or expired search unwinds without starting second branches */
+                branches = !solution_found && !search->stats.expired && !(worker && tpool_is_aborted(worker->pool))
+                    && vc_maxdeg_second(graph, cover, search, &child_k);
+                /* fall through */
+            case VC_STAGE_SECOND:
+                if(!branches)
+                    frame->exhausted = (search->num_spawned == frame->num_spawned);
+                break;
+        }
+
+        if(branches)
+            vc_maxdeg_push(search, graph, cover, child_k);
+        else
+            vc_maxdeg_pop(graph, cover, search, worker, solution_found);
+    }
+
+    return solution_found;
+}
+
+bool vc_maxdeg_recursive(const subgraph_t const *subgraph, int k, const vc_options_t const *options, vc_stats_t *stats, stack_t *cover)
+{
+    subgraph_t graph;
+    vc_search_t search;
+    bool ready, solution_found = false;
+
+    /* the only copy of the search, every node works on it and undoes its changes */
+    ready = subgraph_init_copy(&graph, subgraph) && subgraph_enable_buckets(&graph) && subgraph_enable_trail(&graph);
+    ready = vc_search_init(&search, options, subgraph) && ready;
+    if(ready && vc_search_enable_table(&search, subgraph, (uint64_t) options->table_size << 20))
+    {
+        vc_search_reserve(&search, subgraph, k);
+        if(cover)
+            stack_reserve(cover, subgraph_base_num_vertices(subgraph));
+
+        solution_found = vc_maxdeg_search(&graph, k, cover, &search, NULL);
+    }
+    else
+        vc_search_fail(&search, NULL);
+
+    vc_stats_add(stats, &(search.stats));
+    vc_search_destroy(&search);
+    subgraph_destroy(&graph);
+    return solution_found;
+}
+
+void vc_maxdeg_parallel_task(tpool_worker_t *worker, void *data)
+{
+    vc_maxdeg_task_t *task = (vc_maxdeg_task_t *) data;
+    vc_maxdeg_parallel_t *shared = (vc_maxdeg_parallel_t *) worker->pool->context;
+    stack_t *cover = shared->cover ? &(task->cover) : NULL;
+
+    ((vc_search_t *) worker->context)->kernel_size = subgraph_num_vertices(&(task->graph));
+
+    /* copies don't inherit the trail */
+    if(!subgraph_enable_trail(&(task->graph)))
+        vc_search_fail((vc_search_t *) worker->context, worker);
+    else if(vc_maxdeg_search(&(task->graph), task->k, cover, (vc_search_t *) worker->context, worker))
+    {
+        int expected = 0;
+
+        /* only the first worker that finds a solution reports its vc */
+        if(__atomic_compare_exchange_n(&(shared->solution_found), &expected, 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) && cover)
+            vc_cover_append(shared->cover, cover);
+        tpool_abort(worker->pool);
+    }
+
+    subgraph_destroy(&(task->graph));
+    if(cover)
+        stack_destroy(cover);
+}
+
+/* creates the state of every worker, returns NULL if memory could not be allocated */
+vc_search_t *vc_parallel_init(tpool_t *pool, const vc_options_t const *options, const subgraph_t const *subgraph)
+{
+    vc_search_t *searches = (vc_search_t *) malloc(sizeof(vc_search_t) * pool->num_workers);
+
+    if(searches == NULL)
+        return NULL;
+
+    for(uint32_t i = 0; i < pool->num_workers; i++)
+    {
+        if(!vc_search_init(&(searches[i]), options, subgraph)
+            || ((options->algorithm == VC_ALGO_MAXDEG_PAR) && !vc_search_enable_table(&(searches[i]), subgraph, ((uint64_t) options->table_size << 20) / pool->num_workers)))
+        {
+            for(uint32_t j = 0; j <= i; j++)
+                vc_search_destroy(&(searches[j]));
+            free(searches);
+            return NULL;
+        }
+        tpool_set_worker_context(pool, i, &(searches[i]));
+    }
+
+    return searches;
+}
+
+void vc_parallel_destroy(tpool_t *pool, vc_search_t *searches, vc_stats_t *stats)
+{
+    for(uint32_t i = 0; i < pool->num_workers; i++)
+    {
+        vc_stats_add(stats, &(searches[i].stats));
+        vc_search_destroy(&(searches[i]));
+    }
+    free(searches);
+}
+
+bool vc_maxdeg_parallel(const subgraph_t const *subgraph, int k, const vc_options_t const *options, vc_stats_t *stats, stack_t *cover)
+{
+    tpool_t pool;
+    vc_maxdeg_parallel_t shared;
+    vc_maxdeg_task_t task;
+    vc_search_t *searches;
+
+    shared.cover = cover;
+    shared.solution_found = 0;
+    if(!tpool_init(&pool, options->num_threads, sizeof(vc_maxdeg_task_t), vc_maxdeg_parallel_task, vc_maxdeg_parallel_discard, &shared))
+        return vc_maxdeg_recursive(subgraph, k, options, stats, cover);
+
+    searches = vc_parallel_init(&pool, options, subgraph);
+    if(searches == NULL)
+    {
+        tpool_destroy(&pool);
+        return vc_maxdeg_recursive(subgraph, k, options, stats, cover);
+    }
+    for(uint32_t i = 0; i < pool.num_workers; i++)
+        vc_search_reserve(&(searches[i]), subgraph, k);
+
+    if(!subgraph_init_copy(&(task.graph), subgraph) || !subgraph_enable_buckets(&(task.graph)))
+    {
+        subgraph_destroy(&(task.graph));
+        vc_parallel_destroy(&pool, searches, stats);
+        tpool_destroy(&pool);
+        vc_stats_fail(stats);
+        return false;
+    }
+    if(cover)
+        stack_init(&(task.cover), sizeof(vertex_t));
+    task.k = k;
+    tpool_run(&pool, &task);
+
+    vc_parallel_destroy(&pool, searches, stats);
+    tpool_destroy(&pool);
+
+    return (shared.solution_found != 0);
+}
+
+/* the partial vc of vc_simple changes only by these two functions, which keep the remaining graph in sync if a bound is used */
+void vc_simple_take(vc_search_t *search, subgraph_t *vc_partial, vertex_t vertex)
+{
+    subgraph_add_vertex(vc_partial, vertex);
+    if(search->options->bound != LB_NONE)
+        subgraph_remove_vertex(&(search->remaining), vertex);
+}
+
+void vc_simple_untake(vc_search_t *search, subgraph_t *vc_partial, vertex_t vertex)
+{
+    subgraph_remove_vertex(vc_partial, vertex);
+    if(search->options->bound != LB_NONE)
+        subgraph_add_vertex(&(search->remaining), vertex);
+}
+
+/* sets up the remaining graph for a search that starts at 'vc_partial', returns false if memory ran out */
+bool vc_simple_prepare(vc_search_t *search, const subgraph_t const *subgraph, const subgraph_t const *vc_partial)
+{
+    subgraph_iter_t iter_vertices;
+    vertex_t vertex;
+
+    if(search->options->bound == LB_NONE)
+        return true;
+
+    if(!subgraph_copy(&(search->remaining), subgraph))
+        return false;
+    subgraph_iter_all_vertices(vc_partial, &iter_vertices);
+    while(subgraph_iter_next(vc_partial, &iter_vertices, &vertex))
+        subgraph_remove_vertex(&(search->remaining), vertex);
+    subgraph_iter_destroy(&iter_vertices);
+    return true;
+}
+
+/* hands the oldest unexplored alternative to an idle worker: the second branch of the bottom-most frame whose first branch is active */
+void vc_simple_donate(subgraph_t *vc_partial, stack_t *tree_stack, tpool_worker_t *worker)
+{
+    vc_simple_task_t task;
+    vc_simple_state_t *state;
+    uint32_t i, height = stack_height(tree_stack), bottom = height;
+
+    /* undo the stack from the top to find out which branch every frame is in, without memory for a copy nothing is donated */
+    if(!subgraph_init_copy(&(task.vc_partial), vc_partial))
+    {
+        subgraph_destroy(&(task.vc_partial));
+        return;
+    }
+    for(i = height; i-- > 0; )
+    {
+        state = (vc_simple_state_t *) stack_get_element_ptr(tree_stack, i);
+        if(subgraph_contains_vertex(&(task.vc_partial), state->u))
+        {
+            subgraph_remove_vertex(&(task.vc_partial), state->u);
+            if(!state->donated)
+                bottom = i;
+        }
+        else
+            subgraph_remove_vertex(&(task.vc_partial), state->v);
+    }
+
+    if(bottom == height)
+    {
+        subgraph_destroy(&(task.vc_partial));
+        return;
+    }
+
+    /* rebuild the partial vertex cover of the frame that is donated, the partial vc has neither buckets nor overlay to allocate */
+    subgraph_copy(&(task.vc_partial), vc_partial);
+    for(i = height; i-- > bottom; )
+    {
+        state = (vc_simple_state_t *) stack_get_element_ptr(tree_stack, i);
+        if(subgraph_contains_vertex(&(task.vc_partial), state->u))
+            subgraph_remove_vertex(&(task.vc_partial), state->u);
+        else
+            subgraph_remove_vertex(&(task.vc_partial), state->v);
+    }
+
+    state = (vc_simple_state_t *) stack_get_element_ptr(tree_stack, bottom);
+    subgraph_add_vertex(&(task.vc_partial), state->v);
+    task.k = state->k;
+    state->donated = true;
+
+    tpool_spawn(worker, &task);
+}
+
+/* identifies the graph of a checkpoint by its vertices and their neighbors */
+uint64_t vc_simple_hash(const subgraph_t const *subgraph)
+{
+    subgraph_iter_t iter_vertices, iter_neighborhood;
+    vertex_t vertex, neighbor;
+    uint64_t hash = 0x9e3779b97f4a7c15ull ^ subgraph_base_num_vertices(subgraph);
+
+    subgraph_iter_all_vertices(subgraph, &iter_vertices);
+    while(subgraph_iter_next(subgraph, &iter_vertices, &vertex))
+    {
+        hash = (hash ^ (vertex | 0x100000000ull)) * 0xff51afd7ed558ccdull;
+        hash ^= hash >> 32;
+        subgraph_iter_neighborhood(subgraph, &iter_neighborhood, vertex);
+        while(subgraph_iter_next(subgraph, &iter_neighborhood, &neighbor))
+        {
+            hash = (hash ^ neighbor) * 0xff51afd7ed558ccdull;
+            hash ^= hash >> 32;
+        }
+        subgraph_iter_destroy(&iter_neighborhood);
+    }
+    subgraph_iter_destroy(&iter_vertices);
+
+    return hash ^ (hash >> 29);
+}
+
+/* writes the current node of vc_simple to the buffer of the checkpoint, returns the size of the snapshot */
+uint32_t vc_simple_snapshot(vc_search_t *search, const subgraph_t const *vc_partial)
+{
+    vc_simple_checkpoint_t *checkpoint = search->checkpoint;
+    const vc_simple_state_t *state;
+    uint32_t height = stack_height(&(search->tree_stack)), magic = VC_CHECKPOINT_MAGIC, version = VC_CHECKPOINT_VERSION, stamp, first, second;
+    uint8_t *frame;
+    int32_t k = checkpoint->k;
+
+    memcpy(checkpoint->buffer, &magic, 4);
+    memcpy(checkpoint->buffer + 4, &version, 4);
+    memcpy(checkpoint->buffer + 8, &(checkpoint->hash), 8);
+    memcpy(checkpoint->buffer + 16, &k, 4);
+    memcpy(checkpoint->buffer + 20, &height, 4);
+    memcpy(checkpoint->buffer + 24, &(search->stats.nodes), 8);
+
+    /* a frame is in its first branch if u is taken and no frame above it took u again, see vc_simple_donate */
+    stamp = vc_search_next_stamp(search, vc_partial);
+    for(uint32_t i = height; i-- > 0; )
+    {
+        state = (const vc_simple_state_t *) stack_get_element_ptr(&(search->tree_stack), i);
+        first = state->u;
+        second = state->v;
+        if(subgraph_contains_vertex(vc_partial, state->u) && (search->marks[state->u] != stamp))
+            search->marks[state->u] = stamp;
+        else
+        {
+            search->marks[state->v] = stamp;
+            second |= VC_CHECKPOINT_SECOND;
+        }
+
+        frame = checkpoint->buffer + VC_CHECKPOINT_HEADER_SIZE + i * VC_CHECKPOINT_FRAME_SIZE;
+        memcpy(frame, &first, 4);
+        memcpy(frame + 4, &second, 4);
+    }
+
+    return VC_CHECKPOINT_HEADER_SIZE + height * VC_CHECKPOINT_FRAME_SIZE;
+}
+
+/* hands a snapshot of the current node to the writer once the interval passed, the node has not been visited yet. fails the search if memory runs out */
+void vc_simple_checkpoint(vc_search_t *search, const subgraph_t const *vc_partial)
+{
+    if((search->stats.nodes % VC_DEADLINE_INTERVAL != 0) || !ckpt_is_due(&(search->checkpoint->writer)))
+        return;
+
+    if(!ckpt_submit(&(search->checkpoint->writer), search->checkpoint->buffer, vc_simple_snapshot(search, vc_partial)))
+        vc_search_fail(search, NULL);
+}
+
+/* rebuilds the tree stack and partial vc of a checkpoint, returns the budget of its node or -1 if it belongs to another search. fails the search if memory runs out */
+int vc_simple_resume(const vc_simple_checkpoint_t const *checkpoint, vc_search_t *search, const subgraph_t const *subgraph, subgraph_t *vc_partial, const char *filename)
+{
+    vc_simple_state_t state;
+    uint32_t size, magic = 0, version = 0, height = 0, first, second;
+    uint64_t hash = 0, nodes = 0;
+    int32_t k = -1;
+    uint8_t *data;
+    bool valid;
+
+    if(!ckpt_load(filename, &data, &size))
+    {
+        vc_search_fail(search, NULL);
+        return -1;
+    }
+    else if(data == NULL)
+    {
+        fprintf(stdout, "[error] could not read checkpoint %s, starting from the root\n", filename);
+        return -1;
+    }
+
+    if(size >= VC_CHECKPOINT_HEADER_SIZE)
+    {
+        memcpy(&magic, data, 4);
+        memcpy(&version, data + 4, 4);
+        memcpy(&hash, data + 8, 8);
+        memcpy(&k, data + 16, 4);
+        memcpy(&height, data + 20, 4);
+        memcpy(&nodes, data + 24, 8);
+    }
+
+    valid = (magic == VC_CHECKPOINT_MAGIC) && (version == VC_CHECKPOINT_VERSION) && (hash == checkpoint->hash) && (k == checkpoint->k)
+        && (height <= (uint32_t) k) && (size == VC_CHECKPOINT_HEADER_SIZE + height * VC_CHECKPOINT_FRAME_SIZE);
+    for(uint32_t i = 0; valid && (i < height); i++)
+    {
+        memcpy(&first, data + VC_CHECKPOINT_HEADER_SIZE + i * VC_CHECKPOINT_FRAME_SIZE, 4);
+        memcpy(&second, data + VC_CHECKPOINT_HEADER_SIZE + i * VC_CHECKPOINT_FRAME_SIZE + 4, 4);
+        second &= ~VC_CHECKPOINT_SECOND;
+        valid = (first < subgraph_base_num_vertices(subgraph)) && (second < subgraph_base_num_vertices(subgraph))
+            && subgraph_contains_vertex(subgraph, first) && subgraph_contains_vertex(subgraph, second);
+    }
+
+    if(!valid)
+    {
+        if(search->options->verbose)
+            fprintf(stdout, "[info] checkpoint %s belongs to another graph or k, starting from the root\n", filename);
+        free(data);
+        return -1;
+    }
+    else if(!stack_reserve(&(search->tree_stack), height))
+    {
+        vc_search_fail(search, NULL);
+        free(data);
+        return -1;
+    }
+
+    for(uint32_t i = 0; i < height; i++)
+    {
+        memcpy(&first, data + VC_CHECKPOINT_HEADER_SIZE + i * VC_CHECKPOINT_FRAME_SIZE, 4);
+        memcpy(&second, data + VC_CHECKPOINT_HEADER_SIZE + i * VC_CHECKPOINT_FRAME_SIZE + 4, 4);
+        state.u = first;
+        state.v = second & ~VC_CHECKPOINT_SECOND;
+        state.k = k - (int) i - 1;
+        state.donated = false;
+        stack_push(&(search->tree_stack), &state);
+        vc_simple_take(search, vc_partial, (second & VC_CHECKPOINT_SECOND) ? state.v : state.u);
+    }
+    search->stats.nodes = nodes;
+    free(data);
+
+    if(search->options->verbose)
+        fprintf(stdout, "[info] resuming from checkpoint %s at depth %u after %" PRIu64 " nodes\n", filename, height, nodes);
+
+    return k - (int) height;
+}
+
+/* extends 'vc_partial' by at most 'k' vertices to a vertex cover, donates branches to idle workers if 'worker' is set */
+bool vc_simple_search(const subgraph_t const *subgraph, subgraph_t *vc_partial, int k, vc_search_t *search, tpool_worker_t *worker)
+{
+    stack_t *tree_stack = &(search->tree_stack);
+    bool solution_found = false;
+    vc_simple_state_t state;
+
+    state.k = k;
+    state.donated = false;
+
+    do
+    {
+        if(vc_search_expired(search, worker))
+            break;
+
+        if(search->checkpoint)
+            vc_simple_checkpoint(search, vc_partial);
+
+        if(worker)
+        {
+            if(tpool_is_aborted(worker->pool))
+                break;
+
+            if((tpool_num_idle(worker->pool) > 0) && (stack_height(tree_stack) > 0) && (tpool_num_queued(worker) == 0))
+                vc_simple_donate(vc_partial, tree_stack, worker);
+        }
+
+        search->stats.nodes++;
+
+        /* first: find any uncovered edge in the graph. we have a solution if no edge exists */
+        if(!find_uncovered_edge(subgraph, vc_partial, &state.u, &state.v))
+        {
+#ifdef VC_SIMPLE_DEBUG
+            fprintf(stdout, "[debug] found solution: ");
+            subgraph_print(vc_partial);
+#endif
+            solution_found = true;
+        }
+        else
+        {
+#ifdef VC_SIMPLE_DEBUG
+            fprintf(stdout, "[debug] found uncovered edge (%u, %u)\n", state.u, state.v);
+#endif
+            if((state.k > 0) && !vc_search_prune(search, &(search->remaining), state.k))
+            {
+                state.k--;
+                state.donated = false;
+                if(!stack_push(tree_stack, &state))
+                {
+                    vc_search_fail(search, worker);
+                    break;
+                }
+                if(stack_height(tree_stack) > search->stats.max_depth)
+                    search->stats.max_depth = stack_height(tree_stack);
+#ifdef VC_SIMPLE_DEBUG
+                fprintf(stdout, "[debug] adding %u to the vertex cover\n", state.u);
+#endif
+                vc_simple_take(search, vc_partial, state.u);
+            }
+            else
+            {
+                bool next_state_found = false;
+                /* it's not possible to create more branches */
+                while(!next_state_found && stack_pop(tree_stack, &state))
+                {
+                    if(subgraph_contains_vertex(vc_partial, state.u))
+                    {
+                        vc_simple_untake(search, vc_partial, state.u);
+                        /* the second branch might be explored by another worker */
+                        if(!state.donated)
+                        {
+#ifdef VC_SIMPLE_DEBUG
+                            fprintf(stdout, "[debug] first branch did not succeed\n");
+                            fprintf(stdout, "[debug] adding %u to the vertex cover\n", state.v);
+#endif
+                            vc_simple_take(search, vc_partial, state.v);
+                            stack_push(tree_stack, &state);
+                            next_state_found = true;
+                        }
+                    }
+                    else
+                    {
+#ifdef VC_SIMPLE_DEBUG
+                        fprintf(stdout, "[debug] second branch did not succeed\n");
+#endif
+                        vc_simple_untake(search, vc_partial, state.v);
+                    }
+                }
+            }
+        }
+    }
+    while(!solution_found && (stack_height(tree_stack) > 0));
+
+    return solution_found;
+}
+
+bool vc_simple(const subgraph_t const *subgraph, int k, const vc_options_t const *options, vc_stats_t *stats, stack_t *cover)
+{
+    subgraph_t graph, vc_partial;
+    vc_search_t search;
+    vc_simple_checkpoint_t checkpoint;
+    bool ready, solution_found;
+    int start_k = k;
+
+    /* the bounds visit vertices by ascending degree */
+    if(!subgraph_init_copy(&graph, subgraph) || ((options->bound != LB_NONE) && !subgraph_enable_buckets(&graph)))
+    {
+        subgraph_destroy(&graph);
+        vc_stats_fail(stats);
+        return false;
+    }
+
+    ready = subgraph_init_induced(&vc_partial, subgraph_get_base_graph(subgraph));
+    ready = vc_search_init(&search, options, &graph) && ready;
+    if(ready && options->checkpoint_filename)
+    {
+        /* the tree stack never holds more than k frames */
+        checkpoint.buffer = (uint8_t *) malloc(VC_CHECKPOINT_HEADER_SIZE + (size_t) k * VC_CHECKPOINT_FRAME_SIZE);
+        if(checkpoint.buffer == NULL)
+        {
+            fprintf(stderr, "Error: could not allocate memory to store checkpoint\n");
+            ready = false;
+        }
+    }
+    if(!ready)
+    {
+        vc_search_fail(&search, NULL);
+        vc_stats_add(stats, &(search.stats));
+        vc_search_destroy(&search);
+        subgraph_destroy(&vc_partial);
+        subgraph_destroy(&graph);
+        return false;
+    }
+
+    if(options->checkpoint_filename || options->resume_filename)
+    {
+        checkpoint.hash = vc_simple_hash(&graph);
+        checkpoint.k = k;
+    }
+    if(options->resume_filename)
+    {
+        start_k = vc_simple_resume(&checkpoint, &search, &graph, &vc_partial, options->resume_filename);
+        if(start_k < 0)
+            start_k = k;
+    }
+    if(options->checkpoint_filename && !search.stats.failed)
+    {
+        if(ckpt_init(&(checkpoint.writer), options->checkpoint_filename, options->checkpoint_interval))
+            search.checkpoint = &checkpoint;
+        else
+            vc_search_fail(&search, NULL);
+    }
+
+    /* the resume or the writer may have run out of memory */
+    solution_found = !search.stats.failed && vc_simple_search(&graph, &vc_partial, start_k, &search, NULL);
+    if(solution_found)
+        vc_cover_add_all(cover, &vc_partial);
+
+    if(search.checkpoint)
+    {
+        /* a search that ran out of time continues at the node it stopped at, a finished one leaves nothing to resume. a search
+         * that failed keeps the last snapshot it handed over */
+        if(search.stats.expired && !search.stats.failed && !ckpt_submit(&(checkpoint.writer), checkpoint.buffer, vc_simple_snapshot(&search, &vc_partial)))
+            vc_search_fail(&search, NULL);
+        else if(!search.stats.expired)
+            ckpt_discard(&(checkpoint.writer));
+        ckpt_destroy(&(checkpoint.writer));
+    }
+    if(options->checkpoint_filename)
+        free(checkpoint.buffer);
+
+    vc_stats_add(stats, &(search.stats));
+    vc_search_destroy(&search);
+    subgraph_destroy(&vc_partial);
+    subgraph_destroy(&graph);
+
+    return solution_found;
+}
+
+void vc_simple_parallel_discard(tpool_worker_t *worker, void *data)
+{
+    vc_simple_task_t *task = (vc_simple_task_t *) data;
+    subgraph_destroy(&(task->vc_partial));
+}
+
+void vc_simple_parallel_task(tpool_worker_t *worker, void *data)
+{
+    vc_simple_task_t *task = (vc_simple_task_t *) data;
+    vc_simple_parallel_t *shared = (vc_simple_parallel_t *) worker->pool->context;
+    vc_search_t *search = (vc_search_t *) worker->context;
+    vc_simple_state_t state;
+
+    if(!vc_simple_prepare(search, shared->subgraph, &(task->vc_partial)))
+        vc_search_fail(search, worker);
+    else if(vc_simple_search(shared->subgraph, &(task->vc_partial), task->k, search, worker))
+    {
+        int expected = 0;
+
+        /* only the first worker that finds a solution reports its vc */
+        if(__atomic_compare_exchange_n(&(shared->solution_found), &expected, 1, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            vc_cover_add_all(shared->cover, &(task->vc_partial));
+        tpool_abort(worker->pool);
+    }
+
+    /* the search stops early if the pool was aborted */
+    while(stack_pop(&(search->tree_stack), &state));
+    subgraph_destroy(&(task->vc_partial));
+}
+
+bool vc_simple_parallel(const subgraph_t const *subgraph, int k, const vc_options_t const *options, vc_stats_t *stats, stack_t *cover)
+{
+    tpool_t pool;
+    vc_simple_parallel_t shared;
+    vc_simple_task_t task;
+    vc_search_t *searches;
+    subgraph_t graph;
+
+    if(!tpool_init(&pool, options->num_threads, sizeof(vc_simple_task_t), vc_simple_parallel_task, vc_simple_parallel_discard, &shared))
+        return vc_simple(subgraph, k, options, stats, cover);
+
+    /* the bounds visit vertices by ascending degree */
+    if(!subgraph_init_copy(&graph, subgraph) || ((options->bound != LB_NONE) && !subgraph_enable_buckets(&graph)))
+    {
+        tpool_destroy(&pool);
+        subgraph_destroy(&graph);
+        vc_stats_fail(stats);
+        return false;
+    }
+
+    shared.subgraph = &graph;
+    shared.cover = cover;
+    shared.solution_found = 0;
+
+    /* every worker reuses its stack for all tasks */
+    searches = vc_parallel_init(&pool, options, &graph);
+    if(searches == NULL)
+    {
+        tpool_destroy(&pool);
+        subgraph_destroy(&graph);
+        return vc_simple(subgraph, k, options, stats, cover);
+    }
+
+    if(!subgraph_init_induced(&(task.vc_partial), subgraph_get_base_graph(subgraph)))
+    {
+        subgraph_destroy(&(task.vc_partial));
+        vc_parallel_destroy(&pool, searches, stats);
+        tpool_destroy(&pool);
+        subgraph_destroy(&graph);
+        vc_stats_fail(stats);
+        return false;
+    }
+    task.k = k;
+    tpool_run(&pool, &task);
+
+    vc_parallel_destroy(&pool, searches, stats);
+    tpool_destroy(&pool);
+    subgraph_destroy(&graph);
+
+    return (shared.solution_found != 0);
+}
+
+bool vc_solve(const vc_options_t const *options, const subgraph_t const *subgraph, int k, vc_stats_t *stats, stack_t *cover)
+{
+    switch(options->algorithm)
+    {
+        case VC_ALGO_SIMPLE:
+            return vc_simple(subgraph, k, options, stats, cover);
+        case VC_ALGO_SIMPLE_PAR:
+            return vc_simple_parallel(subgraph, k, options, stats, cover);
+        case VC_ALGO_MAXDEG:
+            return vc_maxdeg_recursive(subgraph, k, options, stats, cover);
+        case VC_ALGO_MAXDEG_PAR:
+            return vc_maxdeg_parallel(subgraph, k, options, stats, cover);
+        case VC_ALGO_LOCALSEARCH:
+            /* cannot prove that there is no vc, main runs it on the input graph instead */
+            break;
+    }
+
+    return false;
+}
+
+/* tells the live statistics of the options which part of the solver runs */
+void vc_enter_phase(const vc_options_t const *options, stats_phase_t phase)
+{
+    if(options->live)
+        stats_enter_phase(options->live, phase);
+}
+
+/* same as vc_solve, the selected kernel is applied to 'subgraph' first */
+bool vc_solve_preprocessed(const vc_options_t const *options, subgraph_t *subgraph, int k, vc_stats_t *stats, stack_t *cover)
+{
+    vc_search_t search;
+    bool failed;
+    int taken = 0;
+
+    vc_enter_phase(options, STATS_PHASE_KERNEL);
+    if(vc_search_init(&search, options, subgraph))
+        taken = vc_preprocess(&search, subgraph, cover);
+    failed = search.stats.failed;
+    vc_stats_add(stats, &(search.stats));
+    vc_search_destroy(&search);
+
+    if(failed || (taken > k))
+        return false;
+    vc_enter_phase(options, STATS_PHASE_SEARCH);
+    return vc_solve(options, subgraph, k - taken, stats, cover);
+}
+
+/* copies 'subgraph' to 'kernel' and applies all reductions that do not depend on k, returns the number of vertices they took or -1 if memory ran out. 'kernel' has to be destroyed either way */
+int vc_compute_kernel(const vc_options_t const *options, const subgraph_t const *subgraph, subgraph_t *kernel, vc_stats_t *stats, stack_t *cover)
+{
+    vc_search_t search;
+    bool failed;
+    int taken = 0;
+
+    if(!subgraph_init_copy(kernel, subgraph) || !subgraph_enable_buckets(kernel))
+    {
+        vc_stats_fail(stats);
+        return -1;
+    }
+    if(vc_search_init(&search, options, kernel))
+    {
+        taken = vc_static_kernel(&search, kernel, cover);
+        taken += vc_preprocess(&search, kernel, cover);
+    }
+    failed = search.stats.failed;
+    vc_stats_add(stats, &(search.stats));
+    vc_search_destroy(&search);
+
+    return failed ? -1 : taken;
+}
+
+/* returns the size of a minimum vc, or -1 if it is greater than 'limit' */
+int vc_optimize(const vc_options_t const *options, const subgraph_t const *subgraph, int limit, vc_stats_t *stats, stack_t *cover)
+{
+    subgraph_t kernel;
+    stack_t endpoints;
+    lb_t bound;
+    int taken, lower, upper, k;
+
+    /* the kernel without the k-dependent rules is computed once and shared by all attempts */
+    vc_enter_phase(options, STATS_PHASE_KERNEL);
+    taken = vc_compute_kernel(options, subgraph, &kernel, stats, cover);
+    if(taken < 0)
+    {
+        subgraph_destroy(&kernel);
+        return -1;
+    }
+
+    /* the endpoints of a maximal matching form a vc of twice its size */
+    stack_init(&endpoints, sizeof(vertex_t));
+    if(!lb_init(&bound, options->bound, subgraph_get_base_graph(subgraph)))
+    {
+        lb_destroy(&bound);
+        stack_destroy(&endpoints);
+        subgraph_destroy(&kernel);
+        vc_stats_fail(stats);
+        return -1;
+    }
+    lower = lb_matching(&bound, &kernel, INT_MAX, &endpoints);
+    upper = 2 * lower;
+
+    /* the selected bound might be stronger than the matching */
+    k = lb_compute(&bound, &kernel, INT_MAX);
+    if(k > lower)
+        lower = k;
+    lb_destroy(&bound);
+    if(options->verbose)
+        fprintf(stdout, "[info] kernel has %u vertices, %i vertices taken, remaining vc has size %i to %i\n", subgraph_num_vertices(&kernel), taken, lower, upper);
+
+    vc_enter_phase(options, STATS_PHASE_SEARCH);
+    for(k = lower; (k < upper) && (taken + k <= limit); k++)
+    {
+        if(vc_solve(options, &kernel, k, stats, cover))
+            break;
+        if(stats->expired)
+            break;
+        if(options->verbose)
+            fprintf(stdout, "[info] no vertex cover of size %i\n", taken + k);
+    }
+    if(k == upper)
+        vc_cover_append(cover, &endpoints);
+
+    stack_destroy(&endpoints);
+    subgraph_destroy(&kernel);
+
+    if(stats->expired || (taken + k > limit))
+        return -1;
+    return taken + k;
+}
+
+/* exchanges of the local search per edge of the graph when it warm starts an exact algorithm without --ls-time or --ls-steps */
+#define VC_WARMSTART_STEPS_PER_EDGE 10
+#define VC_WARMSTART_MIN_STEPS 10000
+
+/* searches a small vc of the whole graph within the budget of the options, stops once one of size 'target' is found. returns its size or -1 if memory ran out */
+int vc_local_search(const vc_options_t const *options, const graph_t const *graph, int target, stack_t *cover)
+{
+    ls_t ls;
+    int size;
+
+    double seconds = options->ls_time;
+    uint64_t steps = options->ls_steps;
+
+    /* a warm start must not delay NO answers by the seconds of a full local search, it gets a few exchanges per edge */
+    if((options->algorithm != VC_ALGO_LOCALSEARCH) && !options->ls_budget)
+    {
+        seconds = 0.0;
+        steps = VC_WARMSTART_STEPS_PER_EDGE * (uint64_t) graph_num_edges(graph) + VC_WARMSTART_MIN_STEPS;
+    }
+
+    /* the local search ends by the deadline as well */
+    if(options->deadline.tv_sec != 0)
+    {
+        struct timespec now;
+        double remaining;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        remaining = (options->deadline.tv_sec - now.tv_sec) + (options->deadline.tv_nsec - now.tv_nsec) / 1e9;
+        if(remaining < 1e-3)
+            remaining = 1e-3;
+        if((seconds == 0) || (remaining < seconds))
+            seconds = remaining;
+    }
+
+    vc_enter_phase(options, STATS_PHASE_LOCALSEARCH);
+    if(!ls_init(&ls, graph, options->ls_weights, 2463534242u))
+    {
+        ls_destroy(&ls);
+        return -1;
+    }
+    size = (int) ls_run(&ls, (uint32_t) target, steps, seconds, options->verbose);
+    ls_get_cover(&ls, cover);
+    ls_destroy(&ls);
+
+    return size;
+}
+
+/* returns the word that reports a result */
+const char *vc_result_name(vc_result_t result)
+{
+    switch(result)
+    {
+        case VC_RESULT_NO:
+            return "NO";
+        case VC_RESULT_YES:
+            return "YES";
+        case VC_RESULT_UNKNOWN:
+            return "UNKNOWN";
+        case VC_RESULT_ERROR:
+            return "ERROR";
+    }
+
+    return "UNKNOWN";
+}
+
+/* checks a vc that was found by a solver and writes it to 'filename' if set */
+bool vc_report_cover(const graph_t const *graph, const stack_t const *cover, const char *filename)
+{
+    bitset_t vertices;
+    bool valid;
+
+    if(!bitset_init(&vertices, (bitset_index_t) graph_num_vertices(graph)))
+        return false;
+    for(uint32_t i = 0; i < stack_height(cover); i++)
+        bitset_set(&vertices, (bitset_index_t) *((vertex_t *) stack_get_element_ptr(cover, i)));
+
+    valid = graph_verify_cover(graph, &vertices);
+    bitset_destroy(&vertices);
+
+    if(!valid)
+        fprintf(stdout, "[error] vertex cover of size %u does not cover all edges\n", stack_height(cover));
+    else if(filename)
+        valid = graph_save_cover(graph, cover, filename);
+
+    return valid;
+}
+
+/* writes the answer of a run and its statistics as one JSON record to a file, - for stdout */
+bool vc_report_stats(stats_t *live, const char *filename, const char *graph_filename, const graph_t const *graph, int k, const char *algorithm, bool optimize, vc_result_t result, int size)
+{
+    FILE *file = stdout;
+
+    if(strcmp(filename, "-") && ((file = fopen(filename, "w")) == NULL))
+    {
+        fprintf(stdout, "[error] could not write statistics to %s\n", filename);
+        return false;
+    }
+
+    fprintf(file, "{\"graph\": ");
+    stats_write_json_string(file, graph_filename);
+    fprintf(file, ", \"vertices\": %u, \"edges\": %u, \"k\": %i, \"algorithm\": ", graph_num_vertices(graph), graph_num_edges(graph), k);
+    stats_write_json_string(file, algorithm);
+    fprintf(file, ", \"optimize\": %s, \"result\": \"%s\"", optimize ? "true" : "false", vc_result_name(result));
+    if(result == VC_RESULT_YES)
+        fprintf(file, ", \"size\": %i", size);
+    fprintf(file, ", \"stats\": ");
+    stats_write_json(live, file);
+    fprintf(file, "}\n");
+
+    if(file != stdout)
+        fclose(file);
+    return true;
+}
+
+/* checks a vc that was written to 'filename' against the graph */
+bool vc_verify_file(const graph_t const *graph, int k, const char *filename)
+{
+    bitset_t cover;
+    uint32_t size = 0;
+    bool valid;
+
+    if(!graph_load_cover(graph, &cover, filename))
+        return false;
+
+    for(vertex_t v = 0; v < graph_num_vertices(graph); v++)
+    {
+        if(bitset_get(&cover, (bitset_index_t) v))
+            size++;
+    }
+
+    valid = graph_verify_cover(graph, &cover);
+    bitset_destroy(&cover);
+
+    if(!valid)
+        fprintf(stdout, "[info] vertex cover does not cover all edges\n");
+    else if(size > k)
+        fprintf(stdout, "[info] vertex cover has size %u\n", size);
+
+    return valid && (size <= k);
+}
+
+/* initializes 'subgraph' to all of 'graph', returns false if memory ran out. 'subgraph' has to be destroyed either way */
+bool vc_init_subgraph(const vc_options_t const *options, const graph_t const *graph, subgraph_t *subgraph)
+{
+    if(!subgraph_init_induced(subgraph, graph))
+        return false;
+    for(vertex_t v = 0; v < graph_num_vertices(graph); v++)
+        subgraph_add_vertex(subgraph, v);
+    /* folded vertices are kept by every copy of the graph */
+    if(vc_rule_enabled(options, VC_RULE_FOLD) || vc_rule_enabled(options, VC_RULE_TWIN) || vc_rule_enabled(options, VC_RULE_FUNNEL) || vc_rule_enabled(options, VC_RULE_DESK))
+        return subgraph_enable_overlay(subgraph);
+    return true;
+}
+
+/* answers an instance as selected by the options, on YES 'cover' receives the unfolded vc and 'size' its size */
+vc_result_t vc_run(const vc_options_t const *options, const graph_t const *graph, int k, bool optimize, vc_stats_t *stats, stack_t *cover, int *size)
+{
+    subgraph_t subgraph;
+    stack_t warm_cover;
+    int upper = INT_MAX;
+    vc_result_t result = VC_RESULT_NO;
+    bool ready;
+
+    ready = vc_init_subgraph(options, graph, &subgraph);
+
+    /* the local search gives an upper bound on the size of a minimum vc */
+    stack_init(&warm_cover, sizeof(vertex_t));
+    if(ready && ((options->algorithm == VC_ALGO_LOCALSEARCH) || options->warmstart))
+        upper = vc_local_search(options, graph, optimize ? 0 : k, &warm_cover);
+
+    if(!ready || (upper < 0))
+        vc_stats_fail(stats);
+    else if(options->algorithm == VC_ALGO_LOCALSEARCH)
+    {
+        vc_cover_append(cover, &warm_cover);
+        *size = upper;
+        result = (optimize || (upper <= k)) ? VC_RESULT_YES : VC_RESULT_UNKNOWN;
+    }
+    else if(optimize)
+    {
+        int limit = (k > 0) ? k : INT_MAX;
+
+        /* the exact search only has to look for a vc that is smaller than the one of the local search */
+        *size = vc_optimize(options, &subgraph, (upper <= limit) ? upper - 1 : limit, stats, cover);
+        if((*size < 0) && (upper <= limit) && !stats->expired)
+        {
+            *size = upper;
+            vc_cover_restore(cover, 0);
+            vc_cover_append(cover, &warm_cover);
+        }
+        if(*size >= 0)
+            result = VC_RESULT_YES;
+    }
+    else if(upper <= k)
+    {
+        vc_cover_append(cover, &warm_cover);
+        result = VC_RESULT_YES;
+    }
+    else if(vc_solve_preprocessed(options, &subgraph, k, stats, cover))
+        result = VC_RESULT_YES;
+
+    if((result == VC_RESULT_YES) && !vc_cover_unfold(cover, graph))
+    {
+        vc_stats_fail(stats);
+        result = VC_RESULT_ERROR;
+    }
+    else if(result == VC_RESULT_YES)
+    {
+        if(!optimize)
+            *size = (int) stack_height(cover);
+    }
+    else if(stats->failed)
+        result = VC_RESULT_ERROR;
+    else if(stats->expired)
+        result = VC_RESULT_UNKNOWN;
+
+    stack_destroy(&warm_cover);
+    subgraph_destroy(&subgraph);
+
+    return result;
+}
+
+/* sets the defaults of all options */
+void vc_options_init(vc_options_t *options, vc_algorithm_t algorithm)
+{
+    options->algorithm = algorithm;
+    options->num_threads = tpool_num_cpus();
+    options->bound = LB_NONE;
+    options->kernel = VC_KERNEL_NONE;
+    options->rekernel = 0;
+    options->rules = 0;
+    options->components = false;
+    options->table_size = 0;
+    options->branching = VC_BRANCH_MAXDEG;
+    options->ls_time = 10.0;
+    options->ls_steps = 0;
+    options->ls_budget = false;
+    options->ls_weights = false;
+    options->warmstart = false;
+    options->verbose = true;
+    options->time_limit = 0.0;
+    options->deadline.tv_sec = 0;
+    options->deadline.tv_nsec = 0;
+    options->checkpoint_filename = NULL;
+    options->checkpoint_interval = 5.0;
+    options->resume_filename = NULL;
+    options->live = NULL;
+}
+
+/* sets the deadline of the options to 'time_limit' seconds from now */
+void vc_options_start_clock(vc_options_t *options)
+{
+    if(options->time_limit <= 0)
+        return;
+
+    clock_gettime(CLOCK_MONOTONIC, &(options->deadline));
+    options->deadline.tv_sec += (time_t) options->time_limit;
+    options->deadline.tv_nsec += (long) ((options->time_limit - (time_t) options->time_limit) * 1e9);
+    if(options->deadline.tv_nsec >= 1000000000L)
+    {
+        options->deadline.tv_sec++;
+        options->deadline.tv_nsec -= 1000000000L;
+    }
+}
+
+/* reads the options that follow the positional arguments, starting at argv[first] */
+bool vc_parse_options(vc_options_t *options, int argc, char **argv, int first, bool *optimize, const char **cover_filename, const char **stats_filename)
+{
+    for(int i = first; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "--threads") && (i + 1 < argc))
+        {
+            int value = atoi(argv[++i]);
+            options->num_threads = (value > 0) ? (uint32_t) value : 1;
+        }
+        else if(!strcmp(argv[i], "--bound") && (i + 1 < argc))
+        {
+            int bound_index = -1;
+
+            i++;
+            for(int j = 0; j < sizeof(vc_bound_names) / sizeof(vc_bound_names[0]); j++)
+            {
+                if(!strcmp(argv[i], vc_bound_names[j].name))
+                    bound_index = j;
+            }
+
+            if(bound_index < 0)
+            {
+                fprintf(stdout, "[error] unknown bound %s\n", argv[i]);
+                return false;
+            }
+            options->bound = vc_bound_names[bound_index].bound;
+        }
+        else if(!strcmp(argv[i], "--kernel") && (i + 1 < argc))
+        {
+            int kernel_index = -1;
+
+            i++;
+            for(int j = 0; j < sizeof(vc_kernel_names) / sizeof(vc_kernel_names[0]); j++)
+            {
+                if(!strcmp(argv[i], vc_kernel_names[j].name))
+                    kernel_index = j;
+            }
+
+            if(kernel_index < 0)
+            {
+                fprintf(stdout, "[error] unknown kernel %s\n", argv[i]);
+                return false;
+            }
+            options->kernel = vc_kernel_names[kernel_index].kernel;
+        }
+        else if(!strcmp(argv[i], "--branching") && (i + 1 < argc))
+        {
+            int branching_index = -1;
+
+            i++;
+            for(int j = 0; j < sizeof(vc_branching_names) / sizeof(vc_branching_names[0]); j++)
+            {
+                if(!strcmp(argv[i], vc_branching_names[j].name))
+                    branching_index = j;
+            }
+
+            if(branching_index < 0)
+            {
+                fprintf(stdout, "[error] unknown branching %s\n", argv[i]);
+                return false;
+            }
+            options->branching = vc_branching_names[branching_index].branching;
+        }
+        else if(!strcmp(argv[i], "--rekernel") && (i + 1 < argc))
+        {
+            int value = atoi(argv[++i]);
+            options->rekernel = (value > 0) ? (uint32_t) ((value < 100) ? value : 100) : 0;
+        }
+        else if(!strcmp(argv[i], "--rules") && (i + 1 < argc))
+        {
+            char *list = argv[++i];
+
+            options->rules = 0;
+            for(char *name = strtok(list, ","); name; name = strtok(NULL, ","))
+            {
+                int rule_index = -1;
+
+                if(!strcmp(name, "none"))
+                    continue;
+
+                for(int j = 0; j < sizeof(vc_rule_names) / sizeof(vc_rule_names[0]); j++)
+                {
+                    if(!strcmp(name, vc_rule_names[j].name))
+                        rule_index = j;
+                }
+
+                if(rule_index < 0)
+                {
+                    fprintf(stdout, "[error] unknown rule %s\n", name);
+                    return false;
+                }
+                options->rules |= 1u << vc_rule_names[rule_index].rule;
+            }
+        }
+        else if(!strcmp(argv[i], "--components"))
+            options->components = true;
+        else if(!strcmp(argv[i], "--table") && (i + 1 < argc))
+        {
+            int value = atoi(argv[++i]);
+            options->table_size = (value > 0) ? (uint32_t) value : 0;
+        }
+        else if(!strcmp(argv[i], "--ls-time") && (i + 1 < argc))
+        {
+            double value = atof(argv[++i]);
+            options->ls_time = (value > 0) ? value : 0.0;
+            options->ls_budget = true;
+        }
+        else if(!strcmp(argv[i], "--ls-steps") && (i + 1 < argc))
+        {
+            long long value = atoll(argv[++i]);
+            options->ls_steps = (value > 0) ? (uint64_t) value : 0;
+            options->ls_budget = true;
+        }
+        else if(!strcmp(argv[i], "--time-limit") && (i + 1 < argc))
+        {
+            double value = atof(argv[++i]);
+            options->time_limit = (value > 0) ? value : 0.0;
+        }
+        else if(!strcmp(argv[i], "--checkpoint") && (i + 1 < argc))
+            options->checkpoint_filename = argv[++i];
+        else if(!strcmp(argv[i], "--checkpoint-interval") && (i + 1 < argc))
+        {
+            double value = atof(argv[++i]);
+            options->checkpoint_interval = (value > 0) ? value : 0.0;
+        }
+        else if(!strcmp(argv[i], "--resume") && (i + 1 < argc))
+            options->resume_filename = argv[++i];
+        else if(!strcmp(argv[i], "--ls-weights"))
+            options->ls_weights = true;
+        else if(!strcmp(argv[i], "--warmstart"))
+            options->warmstart = true;
+        else if(!strcmp(argv[i], "--optimize"))
+            *optimize = true;
+        else if(!strcmp(argv[i], "--cover") && (i + 1 < argc))
+            *cover_filename = argv[++i];
+        else if(!strcmp(argv[i], "--stats-json") && (i + 1 < argc))
+            *stats_filename = argv[++i];
+        else
+        {
+            fprintf(stdout, "[error] unknown option %s\n", argv[i]);
+            return false;
+        }
+    }
+
+    if((options->ls_time == 0) && (options->ls_steps == 0))
+    {
+        fprintf(stdout, "[error] the local search needs a limit, use --ls-time or --ls-steps\n");
+        return false;
+    }
+
+    /* only the state of the sequential edge branching is small enough to be written every few seconds */
+    if((options->checkpoint_filename || options->resume_filename) && (options->algorithm != VC_ALGO_SIMPLE))
+    {
+        fprintf(stdout, "[error] --checkpoint and --resume are only supported by the algorithm simple\n");
+        return false;
+    }
+
+    return true;
+}
+
+/* a graph of the batch, loaded by the first job that needs it */
+struct _vc_batch_graph_s
+{
+    char *path;
+    pthread_mutex_t lock;
+    bool loaded;
+    bool failed;
+    graph_t graph;
+};
+typedef struct _vc_batch_graph_s vc_batch_graph_t;
+
+struct _vc_batch_job_s
+{
+    uint32_t line; /* line of the job in the input, identifies its result */
+    uint32_t graph; /* index into the graphs of the batch */
+    int k;
+    int algorithm_index; /* -1 if the line could not be parsed */
+};
+typedef struct _vc_batch_job_s vc_batch_job_t;
+
+struct _vc_batch_s
+{
+    const vc_options_t *options;
+    bool optimize;
+    stack_t graphs; /* pointers to the graphs, whose locks must not move */
+    stack_t jobs;
+    uint32_t next_job; /* accessed atomically */
+    bool failed; /* a job could not be answered, accessed atomically */
+};
+typedef struct _vc_batch_s vc_batch_t;
+
+/* stores the index of the graph with this path in 'index', adds it if it was not seen yet. returns false if memory ran out */
+bool vc_batch_find_graph(vc_batch_t *batch, const char *path, uint32_t *index)
+{
+    vc_batch_graph_t *entry;
+
+    for(uint32_t i = 0; i < stack_height(&(batch->graphs)); i++)
+    {
+        if(!strcmp((*((vc_batch_graph_t **) stack_get_element_ptr(&(batch->graphs), i)))->path, path))
+        {
+            *index = i;
+            return true;
+        }
+    }
+
+    entry = (vc_batch_graph_t *) malloc(sizeof(vc_batch_graph_t));
+    if(entry)
+        entry->path = (char *) malloc(strlen(path) + 1);
+    if((entry == NULL) || (entry->path == NULL) || !stack_push(&(batch->graphs), &entry))
+    {
+        fprintf(stderr, "[batch] Error: could not allocate memory to store graph\n");
+        if(entry)
+            free(entry->path);
+        free(entry);
+        return false;
+    }
+    strcpy(entry->path, path);
+    pthread_mutex_init(&(entry->lock), NULL);
+    entry->loaded = false;
+    entry->failed = false;
+
+    *index = stack_height(&(batch->graphs)) - 1;
+    return true;
+}
+
+/* reads all job lines '<graph.dgf> <size-of-vc> <algorithm>', empty lines and lines starting with '#' are skipped. returns false if the file cannot be read or memory ran out */
+bool vc_batch_read(vc_batch_t *batch, const char *filename)
+{
+    FILE *fd = stdin;
+    char buffer[GRAPH_MAX_INPUT_BUFFER_SIZE], path[GRAPH_MAX_INPUT_BUFFER_SIZE], name[32];
+    uint32_t line = 0;
+
+    if(strcmp(filename, "-") && ((fd = fopen(filename, "rb")) == NULL))
+    {
+        fprintf(stdout, "[error] could not open job file %s\n", filename);
+        return false;
+    }
+
+    while(fgets(buffer, GRAPH_MAX_INPUT_BUFFER_SIZE, fd))
+    {
+        vc_batch_job_t job;
+        char *first = buffer + strspn(buffer, " \t\r\n");
+
+        line++;
+        if((*first == '\0') || (*first == '#'))
+            continue;
+
+        job.line = line;
+        job.graph = 0;
+        job.k = 0;
+        job.algorithm_index = -1;
+        if(sscanf(first, "%s %i %31s", path, &(job.k), name) == 3)
+        {
+            for(int i = 0; i < sizeof(vc_algorithm_names) / sizeof(vc_algorithm_names[0]); i++)
             {
-                bool next_state_found = false;
-                /* it's not possible to create more branches */
-                while(!next_state_found && stack_pop(&tree_stack, &state))
-                {
-                    if(subgraph_contains_vertex(&vc_partial, state.u))
-                    {
-#ifdef VC_SIMPLE_DEBUG
-                        fprintf(stdout, "[debug] first branch did not succeed\n");
-                        fprintf(stdout, "[debug] adding %u to the vertex cover\n", state.v);
-#endif
-                        subgraph_remove_vertex(&vc_partial, state.u);
-                        subgraph_add_vertex(&vc_partial, state.v);
-                        stack_push(&tree_stack, &state);
-                        next_state_found = true;
-                    }
-                    else
-                    {
-#ifdef VC_SIMPLE_DEBUG
-                        fprintf(stdout, "[debug] second branch did not succeed\n");
-#endif
-                        subgraph_remove_vertex(&vc_partial, state.v);
-                    }
-                }
+                if(!strcmp(name, vc_algorithm_names[i].name))
+                    job.algorithm_index = i;
             }
+            if((job.algorithm_index >= 0) && !vc_batch_find_graph(batch, path, &(job.graph)))
+            {
+                if(fd != stdin)
+                    fclose(fd);
+                return false;
+            }
+        }
+        if(job.k < 0)
+            job.k = 0;
+        if(!stack_push(&(batch->jobs), &job))
+        {
+            if(fd != stdin)
+                fclose(fd);
+            return false;
         }
     }
-    while(!solution_found && (stack_height(&tree_stack) > 0));
 
-    stack_destroy(&tree_stack);
-    subgraph_destroy(&vc_partial);
+    if(fd != stdin)
+        fclose(fd);
+    return true;
+}
 
-    return solution_found;
+/* loads the graph of a job unless another job did so already, returns NULL if it cannot be loaded */
+const graph_t *vc_batch_load(vc_batch_t *batch, uint32_t index)
+{
+    vc_batch_graph_t *entry = *((vc_batch_graph_t **) stack_get_element_ptr(&(batch->graphs), index));
+
+    /* jobs of other graphs go on while this one is parsed */
+    pthread_mutex_lock(&(entry->lock));
+    if(!entry->loaded && !entry->failed)
+    {
+        if(graph_load_dimacs(&(entry->graph), entry->path, false))
+            entry->loaded = true;
+        else
+            entry->failed = true;
+    }
+    pthread_mutex_unlock(&(entry->lock));
+
+    return entry->loaded ? &(entry->graph) : NULL;
 }
 
-int main(int argc, char **argv)
+/* solves one job and prints its result line, returns false if the line reports an error */
+bool vc_batch_run_job(vc_batch_t *batch, const vc_batch_job_t const *job)
+{
+    const vc_algorithm_name_t *algorithm = &(vc_algorithm_names[job->algorithm_index]);
+    const char *path = (*((vc_batch_graph_t **) stack_get_element_ptr(&(batch->graphs), job->graph)))->path;
+    const graph_t *graph;
+    vc_options_t options = *(batch->options);
+    vc_stats_t stats = { 0 };
+    struct timespec start, end;
+    stack_t cover;
+    vc_result_t result;
+    bool valid = true;
+    int size = 0;
+
+    graph = vc_batch_load(batch, job->graph);
+    if(graph == NULL)
+    {
+        fprintf(stdout, "job %u: %s %i %s: [error] could not load graph\n", job->line, path, job->k, algorithm->name);
+        return false;
+    }
+
+    /* the batch runs jobs in parallel, every job runs on one thread */
+    options.algorithm = algorithm->algorithm;
+    options.num_threads = 1;
+    vc_options_start_clock(&options);
+
+    stack_init(&cover, sizeof(vertex_t));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    result = vc_run(&options, graph, job->k, batch->optimize, &stats, &cover, &size);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if(result == VC_RESULT_ERROR)
+    {
+        fprintf(stdout, "job %u: %s %i %s: [error] could not allocate memory\n", job->line, path, job->k, algorithm->name);
+        valid = false;
+    }
+    else if((result == VC_RESULT_YES) && !vc_report_cover(graph, &cover, NULL))
+    {
+        fprintf(stdout, "job %u: %s %i %s: [error] invalid vertex cover\n", job->line, path, job->k, algorithm->name);
+        valid = false;
+    }
+    else if(result == VC_RESULT_YES)
+        fprintf(stdout, "job %u: %s %i %s: YES, size %i, nodes %" PRIu64 ", time %.3f s\n", job->line, path, job->k, algorithm->name, size, stats.nodes, (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+    else
+        fprintf(stdout, "job %u: %s %i %s: %s, nodes %" PRIu64 ", time %.3f s\n", job->line, path, job->k, algorithm->name, vc_result_name(result), stats.nodes, (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+    fflush(stdout);
+
+    stack_destroy(&cover);
+    return valid;
+}
+
+/* every worker takes the next job until all are done */
+void vc_batch_task(tpool_worker_t *worker, void *data)
+{
+    vc_batch_t *batch = (vc_batch_t *) worker->pool->context;
+    uint32_t index;
+
+    /* the first task starts one for every other worker */
+    if(*((bool *) data))
+    {
+        bool helper = false;
+
+        for(uint32_t i = 1; i < worker->pool->num_workers; i++)
+            tpool_spawn(worker, &helper);
+    }
+
+    while((index = __atomic_fetch_add(&(batch->next_job), 1, __ATOMIC_RELAXED)) < stack_height(&(batch->jobs)))
+    {
+        vc_batch_job_t *job = (vc_batch_job_t *) stack_get_element_ptr(&(batch->jobs), index);
+
+        if(job->algorithm_index < 0)
+        {
+            fprintf(stdout, "job %u: [error] expected <graph.dgf> <size-of-vc> <algorithm> with a known algorithm\n", job->line);
+            fflush(stdout);
+            __atomic_store_n(&(batch->failed), true, __ATOMIC_RELAXED);
+        }
+        else if(!vc_batch_run_job(batch, job))
+            __atomic_store_n(&(batch->failed), true, __ATOMIC_RELAXED);
+    }
+}
+
+/* runs all jobs of a file on a pool of 'options->num_threads' workers, graphs are loaded once and shared by their jobs. returns false if the jobs could not be run or one of them could not be answered */
+bool vc_batch(const vc_options_t const *options, bool optimize, const char *filename)
+{
+    vc_batch_t batch;
+    tpool_t pool;
+    bool first = true, success = false;
+
+    batch.options = options;
+    batch.optimize = optimize;
+    batch.next_job = 0;
+    batch.failed = false;
+    stack_init(&(batch.graphs), sizeof(vc_batch_graph_t *));
+    stack_init(&(batch.jobs), sizeof(vc_batch_job_t));
+
+    if(vc_batch_read(&batch, filename) && tpool_init(&pool, options->num_threads, sizeof(bool), vc_batch_task, NULL, &batch))
+    {
+        tpool_run(&pool, &first);
+        tpool_destroy(&pool);
+        success = !batch.failed;
+    }
+
+    for(uint32_t i = 0; i < stack_height(&(batch.graphs)); i++)
+    {
+        vc_batch_graph_t *entry = *((vc_batch_graph_t **) stack_get_element_ptr(&(batch.graphs), i));
+
+        if(entry->loaded)
+            graph_destroy(&(entry->graph));
+        pthread_mutex_destroy(&(entry->lock));
+        free(entry->path);
+        free(entry);
+    }
+    stack_destroy(&(batch.graphs));
+    stack_destroy(&(batch.jobs));
+    return success;
+}
+
+/* a graph of the server together with its kernel, which serves every query on the graph */
+struct _vc_served_graph_s
 {
+    char *path; /* identifies the graph in queries */
     graph_t graph;
+    subgraph_t kernel;
+    stack_t kernel_cover; /* vertices and records of the reductions that computed the kernel */
+    int taken; /* size of the vc that the reductions took */
+};
+typedef struct _vc_served_graph_s vc_served_graph_t;
+
+/* sends a line to a client, a client that went away is ignored */
+void vc_serve_reply(int fd, const char *format, ...)
+{
+    char buffer[256];
+    va_list arguments;
+    int length, sent = 0;
+
+    va_start(arguments, format);
+    length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+    va_end(arguments);
+    if(length >= (int) sizeof(buffer))
+        length = sizeof(buffer) - 1;
+
+    while(sent < length)
+    {
+        ssize_t result = send(fd, buffer + sent, (size_t) (length - sent), MSG_NOSIGNAL);
+
+        if(result <= 0)
+            break;
+        sent += (int) result;
+    }
+}
+
+/* returns the position of the graph with this path in 'graphs', -1 if it is not loaded */
+int vc_serve_find(const stack_t const *graphs, const char *path)
+{
+    for(uint32_t i = 0; i < stack_height(graphs); i++)
+    {
+        if(!strcmp((*((vc_served_graph_t **) stack_get_element_ptr(graphs, i)))->path, path))
+            return (int) i;
+    }
+
+    return -1;
+}
+
+/* returns the graph with this path, loads it and computes its kernel first if needed; NULL if it cannot be loaded */
+vc_served_graph_t *vc_serve_load(const vc_options_t const *options, stack_t *graphs, const char *path)
+{
+    vc_served_graph_t *entry;
     subgraph_t subgraph;
-    int k;
+    int index = vc_serve_find(graphs, path);
+
+    if(index >= 0)
+        return *((vc_served_graph_t **) stack_get_element_ptr(graphs, (uint32_t) index));
+
+    /* the kernel points to the graph, so entries do not move */
+    entry = (vc_served_graph_t *) malloc(sizeof(vc_served_graph_t));
+    if(entry == NULL)
+        return NULL;
+    entry->path = (char *) malloc(strlen(path) + 1);
+    if((entry->path == NULL) || !graph_load_dimacs(&(entry->graph), path, false))
+    {
+        free(entry->path);
+        free(entry);
+        return NULL;
+    }
+    strcpy(entry->path, path);
+
+    stack_init(&(entry->kernel_cover), sizeof(vertex_t));
+    entry->taken = -1;
+    if(vc_init_subgraph(options, &(entry->graph), &subgraph))
+    {
+        entry->taken = vc_compute_kernel(options, &subgraph, &(entry->kernel), NULL, &(entry->kernel_cover));
+        if(entry->taken < 0)
+            subgraph_destroy(&(entry->kernel));
+    }
+    subgraph_destroy(&subgraph);
+
+    /* a graph is not kept if memory ran out for its kernel or its entry */
+    if((entry->taken < 0) || !stack_push(graphs, &entry))
+    {
+        if(entry->taken >= 0)
+            subgraph_destroy(&(entry->kernel));
+        stack_destroy(&(entry->kernel_cover));
+        graph_destroy(&(entry->graph));
+        free(entry->path);
+        free(entry);
+        return NULL;
+    }
+
+    return entry;
+}
+
+/* frees a graph of the server */
+void vc_serve_unload(stack_t *graphs, uint32_t index)
+{
+    vc_served_graph_t *entry = *((vc_served_graph_t **) stack_get_element_ptr(graphs, index));
+
+    subgraph_destroy(&(entry->kernel));
+    stack_destroy(&(entry->kernel_cover));
+    graph_destroy(&(entry->graph));
+    free(entry->path);
+    free(entry);
+
+    /* the last graph takes the place of the removed one */
+    memcpy(stack_get_element_ptr(graphs, index), stack_get_element_ptr(graphs, stack_height(graphs) - 1), sizeof(vc_served_graph_t *));
+    stack_remove_last(graphs);
+}
+
+/* answers a query on the cached kernel of a graph, on YES 'cover' receives the unfolded vc and 'size' its size */
+vc_result_t vc_serve_solve(const vc_options_t const *options, const vc_served_graph_t const *entry, int k, vc_stats_t *stats, stack_t *cover, int *size)
+{
+    if((options->algorithm == VC_ALGO_LOCALSEARCH) || options->warmstart)
+    {
+        *size = vc_local_search(options, &(entry->graph), k, cover);
+        if(*size < 0)
+            return VC_RESULT_ERROR;
+        if(*size <= k)
+            return VC_RESULT_YES;
+        if(options->algorithm == VC_ALGO_LOCALSEARCH)
+            return VC_RESULT_UNKNOWN;
+        vc_cover_restore(cover, 0);
+    }
+
+    if(entry->taken <= k)
+    {
+        vc_cover_append(cover, &(entry->kernel_cover));
+        if(vc_solve(options, &(entry->kernel), k - entry->taken, stats, cover))
+        {
+            if(!vc_cover_unfold(cover, &(entry->graph)))
+                return VC_RESULT_ERROR;
+            *size = (int) stack_height(cover);
+            return VC_RESULT_YES;
+        }
+    }
+
+    if(stats->failed)
+        return VC_RESULT_ERROR;
+    return stats->expired ? VC_RESULT_UNKNOWN : VC_RESULT_NO;
+}
+
+/* handles one request line of a client, returns false if the server is to stop */
+bool vc_serve_request(const vc_options_t const *options, stack_t *graphs, int fd, const char *line)
+{
+    char command[32], path[GRAPH_MAX_INPUT_BUFFER_SIZE], name[32];
+    int num_fields, k = 0, index = -1;
+    double seconds = options->time_limit;
+    vc_served_graph_t *entry;
+
+    num_fields = sscanf(line, "%31s %s", command, path);
+    if(num_fields < 1)
+        return true;
+
+    if(!strcmp(command, "shutdown"))
+    {
+        vc_serve_reply(fd, "OK\n");
+        return false;
+    }
+    else if(!strcmp(command, "load") && (num_fields == 2))
+    {
+        if((entry = vc_serve_load(options, graphs, path)) == NULL)
+            vc_serve_reply(fd, "ERROR could not load graph\n");
+        else
+            vc_serve_reply(fd, "OK %u %u %u %i\n", graph_num_vertices(&(entry->graph)), graph_num_edges(&(entry->graph)), subgraph_num_vertices(&(entry->kernel)), entry->taken);
+    }
+    else if(!strcmp(command, "unload") && (num_fields == 2))
+    {
+        if((index = vc_serve_find(graphs, path)) < 0)
+            vc_serve_reply(fd, "ERROR unknown graph\n");
+        else
+        {
+            vc_serve_unload(graphs, (uint32_t) index);
+            vc_serve_reply(fd, "OK\n");
+        }
+    }
+    else if(sscanf(line, "%s %i %31s %lf", path, &k, name, &seconds) >= 3)
+    {
+        vc_options_t query = *options;
+        vc_stats_t stats = { 0 };
+        struct timespec start, end;
+        vc_result_t result;
+        stack_t cover;
+        int size = 0;
+
+        for(int i = 0; i < sizeof(vc_algorithm_names) / sizeof(vc_algorithm_names[0]); i++)
+        {
+            if(!strcmp(name, vc_algorithm_names[i].name))
+                index = i;
+        }
+
+        if(index < 0)
+        {
+            vc_serve_reply(fd, "ERROR unknown algorithm\n");
+            return true;
+        }
+        if((entry = vc_serve_load(options, graphs, path)) == NULL)
+        {
+            vc_serve_reply(fd, "ERROR could not load graph\n");
+            return true;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        query.algorithm = vc_algorithm_names[index].algorithm;
+        query.time_limit = seconds;
+        vc_options_start_clock(&query);
+
+        stack_init(&cover, sizeof(vertex_t));
+        result = vc_serve_solve(&query, entry, (k > 0) ? k : 0, &stats, &cover, &size);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        if(result == VC_RESULT_ERROR)
+            vc_serve_reply(fd, "ERROR could not allocate memory\n");
+        else if((result == VC_RESULT_YES) && !vc_report_cover(&(entry->graph), &cover, NULL))
+            vc_serve_reply(fd, "ERROR invalid vertex cover\n");
+        else if(result == VC_RESULT_YES)
+            vc_serve_reply(fd, "YES %i %.3f\n", size, (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+        else
+            vc_serve_reply(fd, "%s %.3f\n", vc_result_name(result), (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+        stack_destroy(&cover);
+    }
+    else
+        vc_serve_reply(fd, "ERROR expected <graph.dgf> <size-of-vc> <algorithm> [<seconds>], load, unload or shutdown\n");
+
+    return true;
+}
+
+/* listens on a unix socket and answers the requests of one client after another until a client sends shutdown */
+void vc_serve(const vc_options_t const *options, const char *path)
+{
+    struct sockaddr_un address;
+    struct stat info;
+    stack_t graphs;
+    int server;
+    bool running = true;
+
+    if(strlen(path) >= sizeof(address.sun_path))
+    {
+        fprintf(stdout, "[error] socket path %s is too long\n", path);
+        return;
+    }
+
+    /* a socket that is left over from an earlier server is replaced, any other file is not */
+    if((stat(path, &info) == 0) && S_ISSOCK(info.st_mode))
+        unlink(path);
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+    server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if((server < 0) || (bind(server, (struct sockaddr *) &address, sizeof(address)) != 0) || (listen(server, 16) != 0))
+    {
+        fprintf(stdout, "[error] could not listen on %s (%s)\n", path, strerror(errno));
+        if(server >= 0)
+            close(server);
+        return;
+    }
+
+    fprintf(stdout, "[info] listening on %s\n", path);
+    fflush(stdout);
+
+    stack_init(&graphs, sizeof(vc_served_graph_t *));
+    while(running)
+    {
+        char buffer[GRAPH_MAX_INPUT_BUFFER_SIZE];
+        int client = accept(server, NULL, NULL);
+        FILE *requests;
+
+        if(client < 0)
+        {
+            if(errno == EINTR)
+                continue;
+            fprintf(stdout, "[error] could not accept client (%s)\n", strerror(errno));
+            break;
+        }
+
+        if((requests = fdopen(client, "r")) == NULL)
+        {
+            close(client);
+            continue;
+        }
+        while(running && fgets(buffer, sizeof(buffer), requests))
+            running = vc_serve_request(options, &graphs, client, buffer);
+        fclose(requests);
+    }
+
+    while(stack_height(&graphs) > 0)
+        vc_serve_unload(&graphs, 0);
+    stack_destroy(&graphs);
+    close(server);
+    unlink(path);
+}
+
+int main(int argc, char **argv)
+{
+    graph_t graph;
+    stack_t cover;
+    int k, size = 0, algorithm_index = -1;
+    vc_result_t result;
+    bool optimize = false, verify;
+    const char *cover_filename = NULL, *stats_filename = NULL;
+    vc_options_t options;
+    vc_stats_t stats = { 0 };
+    stats_t live;
+    const char *rule_names[VC_NUM_RULES];
+    struct timespec start, end;
+
+    /* batch and server run many solvers without live statistics, SIGUSR1 must not end them */
+    if((argc >= 3) && (!strcmp(argv[1], "--batch") || !strcmp(argv[1], "--serve")))
+        stats_ignore_signal();
+
+    if((argc >= 3) && !strcmp(argv[1], "--batch"))
+    {
+        vc_options_init(&options, VC_ALGO_MAXDEG);
+        if(!vc_parse_options(&options, argc, argv, 3, &optimize, &cover_filename, &stats_filename))
+            return 0;
+        if(cover_filename || stats_filename)
+        {
+            fprintf(stdout, "[error] --cover and --stats-json are not supported in batch mode\n");
+            return 0;
+        }
+
+        options.verbose = false;
+        return vc_batch(&options, optimize, argv[2]) ? 0 : 1;
+    }
+
+    if((argc >= 3) && !strcmp(argv[1], "--serve"))
+    {
+        vc_options_init(&options, VC_ALGO_MAXDEG);
+        if(!vc_parse_options(&options, argc, argv, 3, &optimize, &cover_filename, &stats_filename))
+            return 0;
+        if(optimize || cover_filename || stats_filename)
+        {
+            fprintf(stdout, "[error] --optimize, --cover and --stats-json are not supported by the server\n");
+            return 0;
+        }
+
+        options.verbose = false;
+        vc_serve(&options, argv[2]);
+        return 0;
+    }
 
     if(argc < 4)
     {
-        fprintf(stdout, "Usage: %s <graph.dgf> <size-of-vc> <algorithm>\n", argv[0]);
+        fprintf(stdout, "Usage: %s <graph.dgf> <size-of-vc> <algorithm> [options]\n", argv[0]);
+        fprintf(stdout, "       %s --batch <jobs> [options]\n", argv[0]);
+        fprintf(stdout, "  reads lines '<graph.dgf> <size-of-vc> <algorithm>' from the file <jobs> (- for stdin) and solves them\n");
+        fprintf(stdout, "  on --threads workers, one thread per job, and prints one line per job; the exit status is 1 if a\n");
+        fprintf(stdout, "  line reports an error\n");
+        fprintf(stdout, "       %s --serve <socket> [options]\n", argv[0]);
+        fprintf(stdout, "  answers requests '<graph.dgf> <size-of-vc> <algorithm> [<seconds>]' on a unix socket with\n");
+        fprintf(stdout, "  YES <size> <time>, NO <time> or UNKNOWN <time>; graphs and their kernels stay loaded, requests\n");
+        fprintf(stdout, "  'load <graph.dgf>', 'unload <graph.dgf>' and 'shutdown' manage the server\n");
         fprintf(stdout, " Available algorithms:\n");
         fprintf(stdout, "  simple     chooses edges and branches on their endpoints\n");
         fprintf(stdout, "  maxdeg     chooses vertex of maximum degree\n");
+        fprintf(stdout, "  simple-par same as simple, idle threads take over unexplored branches\n");
+        fprintf(stdout, "  maxdeg-par same as maxdeg, explores branches in parallel\n");
+        fprintf(stdout, "  localsearch searches a small vc heuristically (FastVC), cannot answer NO\n");
+        fprintf(stdout, "  verify     checks the vc that is read from the file given by --cover\n");
+        fprintf(stdout, " Available options:\n");
+        fprintf(stdout, "  --threads <n>  number of worker threads (default: number of cores), also parse the input graph\n");
+        fprintf(stdout, "  --optimize     computes the size of a minimum vc, <size-of-vc> is an upper limit (0: no limit)\n");
+        fprintf(stdout, "  --cover <file> writes the labels of the vc to a file (- for stdout)\n");
+        fprintf(stdout, "  --bound <name> prunes branches by a lower bound: none (default), matching, clique, lp\n");
+        fprintf(stdout, "  --kernel <name> reduces the graph before the search: none (default), crown, nt\n");
+        fprintf(stdout, "  --rekernel <p> maxdeg applies the kernel again once the graph shrank to p percent (default: 0, never)\n");
+        fprintf(stdout, "  --rules <list> comma-separated optional reductions: none (default), fold, domination, twin, unconfined, funnel, desk\n");
+        fprintf(stdout, "  --components   maxdeg solves the components of a disconnected graph separately\n");
+        fprintf(stdout, "  --table <MiB>  maxdeg remembers subproblems without a vc in a table of this size (default: 0, off)\n");
+        fprintf(stdout, "  --branching <name> branching of maxdeg: maxdeg (default), mirror, satellite (mirrors or satellites)\n");
+        fprintf(stdout, "  --time-limit <s> the solvers give up after s seconds and answer UNKNOWN (default: 0, no limit)\n");
+        fprintf(stdout, "  --ls-time <s>  seconds the local search may run (default: 10, 0: no limit)\n");
+        fprintf(stdout, "  --ls-steps <n> exchanges the local search may make (default: 0, no limit)\n");
+        fprintf(stdout, "  --ls-weights   the local search weights uncovered edges (NuMVC, for small dense graphs)\n");
+        fprintf(stdout, "  --warmstart    runs the local search before an exact algorithm, its vc answers YES if it is small enough;\n");
+        fprintf(stdout, "                 unless --ls-time or --ls-steps is given it makes 10 exchanges per edge\n");
+        fprintf(stdout, "  --checkpoint <file> simple writes its search state to a file every few seconds and when the time limit passes\n");
+        fprintf(stdout, "  --checkpoint-interval <s> seconds between two checkpoints (default: 5)\n");
+        fprintf(stdout, "  --resume <file> simple continues from a checkpoint of the same graph, k and options\n");
+        fprintf(stdout, "  --stats-json <file> writes the answer and statistics of the run as JSON (- for stdout), SIGUSR1 writes\n");
+        fprintf(stdout, "                 a snapshot of the statistics to stderr while the solver runs; batch and server ignore it\n");
         return 0;
     }
 
@@ -427,35 +3993,96 @@ int main(int argc, char **argv)
     if(k < 0)
         k = 0;
 
-    if(!graph_load_dimacs(&graph, argv[1], false))
+    for(int i = 0; i < sizeof(vc_algorithm_names) / sizeof(vc_algorithm_names[0]); i++)
+    {
+        if(!strcmp(argv[3], vc_algorithm_names[i].name))
+            algorithm_index = i;
+    }
+
+    verify = !strcmp(argv[3], "verify");
+    if(!verify && (algorithm_index < 0))
+    {
+        fprintf(stdout, "[error] unknown algorithm was selected\n");
         return 0;
+    }
 
-    fprintf(stdout, "[info] input graph has %u vertices and %u edges\n", graph_num_vertices(&graph), graph_num_edges(&graph));
+    vc_options_init(&options, verify ? VC_ALGO_SIMPLE : vc_algorithm_names[algorithm_index].algorithm);
+    if(!vc_parse_options(&options, argc, argv, 4, &optimize, &cover_filename, &stats_filename))
+        return 0;
 
-    subgraph_init_induced(&subgraph, &graph);
-    for(vertex_t v = 0; v < graph_num_vertices(&graph); v++)
-        subgraph_add_vertex(&subgraph, v);
+    /* SIGUSR1 writes a snapshot of the statistics to stderr, the listener has to start before the worker threads */
+    for(int i = 0; i < VC_NUM_RULES; i++)
+        rule_names[i] = "";
+    for(int i = 0; i < sizeof(vc_rule_names) / sizeof(vc_rule_names[0]); i++)
+        rule_names[vc_rule_names[i].rule] = vc_rule_names[i].name;
+    stats_init(&live, rule_names, VC_NUM_RULES);
+    stats_listen(&live);
+    options.live = &live;
 
-    if(!strcmp(argv[3], "simple"))
+    stats_enter_phase(&live, STATS_PHASE_LOAD);
+    if(!graph_load_dimacs_parallel(&graph, argv[1], false, options.num_threads))
     {
-        if(vc_simple(&subgraph, k))
-            fprintf(stdout, "vc-simple: YES\n");
-        else
-            fprintf(stdout, "vc-simple: NO\n");
+        stats_destroy(&live);
+        return 1;
     }
-    else if(!strcmp(argv[3], "maxdeg"))
+    stats_enter_phase(&live, STATS_PHASE_OTHER);
+
+    fprintf(stdout, "[info] input graph has %u vertices and %u edges\n", graph_num_vertices(&graph), graph_num_edges(&graph));
+
+    if(verify)
     {
-        if(vc_maxdeg_recursive(&subgraph, k))
-            fprintf(stdout, "vc-maxdeg: YES\n");
+        if(cover_filename == NULL)
+            fprintf(stdout, "[error] no vertex cover was given, use --cover\n");
+        else if(vc_verify_file(&graph, k, cover_filename))
+            fprintf(stdout, "vc-verify: YES\n");
         else
-            fprintf(stdout, "vc-maxdeg: NO\n");
+            fprintf(stdout, "vc-verify: NO\n");
+
+        graph_destroy(&graph);
+        stats_destroy(&live);
+        return 0;
     }
+
+    stack_init(&cover, sizeof(vertex_t));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    vc_options_start_clock(&options);
+
+    result = vc_run(&options, &graph, k, optimize, &stats, &cover, &size);
+    stats_enter_phase(&live, STATS_PHASE_OTHER);
+
+    /* the answer is only YES once its vc is checked and written */
+    if((result == VC_RESULT_YES) && !vc_report_cover(&graph, &cover, cover_filename))
+        result = VC_RESULT_ERROR;
+    if((options.algorithm == VC_ALGO_LOCALSEARCH) && optimize && (result != VC_RESULT_ERROR))
+        fprintf(stdout, "vc-%s: smallest vertex cover found has size %i\n", argv[3], size);
+    else if(optimize && (result == VC_RESULT_YES))
+        fprintf(stdout, "vc-%s: minimum vertex cover has size %i\n", argv[3], size);
+    else if(optimize && (result == VC_RESULT_NO))
+        fprintf(stdout, "vc-%s: no vertex cover of size at most %i\n", argv[3], k);
     else
-        fprintf(stdout, "[error] unknown algorithm was selected\n");
+        fprintf(stdout, "vc-%s: %s\n", argv[3], vc_result_name(result));
 
-    subgraph_destroy(&subgraph);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stdout, "[stats] nodes: %" PRIu64 ", pruned: %" PRIu64 ", time: %.3f s\n", stats.nodes, stats.pruned, (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9);
+    if(options.rules)
+    {
+        fprintf(stdout, "[stats] rules:");
+        for(int i = 0; i < sizeof(vc_rule_names) / sizeof(vc_rule_names[0]); i++)
+        {
+            if(vc_rule_enabled(&options, vc_rule_names[i].rule))
+                fprintf(stdout, " %s %" PRIu64, vc_rule_names[i].name, stats.hits[vc_rule_names[i].rule]);
+        }
+        fprintf(stdout, "\n");
+    }
+    if(options.table_size > 0)
+        fprintf(stdout, "[stats] table: hits %" PRIu64 ", misses %" PRIu64 ", evictions %" PRIu64 "\n", stats.table_hits, stats.table_misses, stats.table_evictions);
+    if(stats_filename)
+        vc_report_stats(&live, stats_filename, argv[1], &graph, k, argv[3], optimize, result, size);
+
+    stats_destroy(&live);
+    stack_destroy(&cover);
     graph_destroy(&graph);
 
-    return 0;
+    /* a run that ran out of memory or could not write its vc has no answer */
+    return (result == VC_RESULT_ERROR) ? 1 : 0;
 }
-
@@ -0,0 +1,452 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <inttypes.h>
+#include <time.h>
+#include "bitset.h"
+#include "stack.h"
+#include "queue.h"
+#include "union_find.h"
+
+/*
+    gcc -o vc-microbench -Wall -Wno-duplicate-decl-specifier -O2 microbench.c bitset.c stack.c queue.c union_find.c -std=c99
+    or: make microbench
+
+    times the primitives of the hot paths in isolation: every case runs a few warm-up repetitions and then measured
+    ones, and reports the minimum, median, 90th percentile and maximum time per operation over the repetitions
+ */
+
+/* one measured workload: 'run' prepares its data, times only the primitive and returns the nanoseconds, 'ops' receives the operations */
+struct _mb_case_s
+{
+    const char *name;
+    uint32_t size; /* bits of a set, elements of a stack or queue, nodes of a union-find structure */
+    uint64_t (*run)(const struct _mb_case_s *c, uint64_t *ops);
+};
+typedef struct _mb_case_s mb_case_t;
+
+/* results are added here so that the compiler cannot drop the measured work */
+volatile uint64_t mb_sink;
+
+uint64_t mb_now()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+}
+
+/* xorshift64, every case starts from the same seed so that the repetitions do the same work */
+uint64_t mb_random(uint64_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+int mb_cmp_u32(const void *a, const void *b)
+{
+    uint32_t f = *(const uint32_t *) a, g = *(const uint32_t *) b;
+
+    return (f < g) ? -1 : ((f > g) ? 1 : 0);
+}
+
+int mb_cmp_u64(const void *a, const void *b)
+{
+    uint64_t f = *(const uint64_t *) a, g = *(const uint64_t *) b;
+
+    return (f < g) ? -1 : ((f > g) ? 1 : 0);
+}
+
+/* a set of 'size' values that contains every value with probability 1 / 'sparsity' */
+void mb_random_set(bitset_t *set, uint32_t size, uint32_t sparsity, uint64_t seed)
+{
+    uint64_t state = seed;
+
+    bitset_init(set, (bitset_index_t) size);
+    for(uint32_t i = 0; i < size; i++)
+    {
+        if(mb_random(&state) % sparsity == 0)
+            bitset_set(set, (bitset_index_t) i);
+    }
+}
+
+/* empties a copy of a half-full set, an operation is one element that is found and removed */
+uint64_t mb_bitset_iterate_dense(const mb_case_t *c, uint64_t *ops)
+{
+    bitset_t source, set;
+    bitset_index_t next, last = 0;
+    uint64_t start, end, sum = 0;
+
+    mb_random_set(&source, c->size, 2, 88172645463325252ull);
+    bitset_init_copy(&set, &source);
+    *ops = 0;
+
+    start = mb_now();
+    while(bitset_iterate_set_and_clear(&set, &next, &last))
+    {
+        sum += next;
+        (*ops)++;
+    }
+    end = mb_now();
+
+    mb_sink += sum;
+    bitset_destroy(&set);
+    bitset_destroy(&source);
+    return end - start;
+}
+
+/* same on a set that contains one value in 64, the scan over empty words dominates */
+uint64_t mb_bitset_iterate_sparse(const mb_case_t *c, uint64_t *ops)
+{
+    bitset_t source, set;
+    bitset_index_t next, last = 0;
+    uint64_t start, end, sum = 0;
+
+    mb_random_set(&source, c->size, 64, 88172645463325252ull);
+    bitset_init_copy(&set, &source);
+    *ops = 0;
+
+    start = mb_now();
+    while(bitset_iterate_set_and_clear(&set, &next, &last))
+    {
+        sum += next;
+        (*ops)++;
+    }
+    end = mb_now();
+
+    mb_sink += sum;
+    bitset_destroy(&set);
+    bitset_destroy(&source);
+    return end - start;
+}
+
+/* copies of a set including the allocation, an operation is one copy */
+uint64_t mb_bitset_init_copy(const mb_case_t *c, uint64_t *ops)
+{
+    bitset_t source, set;
+    uint64_t start, end;
+
+    mb_random_set(&source, c->size, 2, 88172645463325252ull);
+    *ops = 10000;
+
+    start = mb_now();
+    for(uint64_t i = 0; i < *ops; i++)
+    {
+        bitset_init_copy(&set, &source);
+        mb_sink += set.bits[i % BITSET_NUM_DATA_ELEMENTS(set.max)];
+        bitset_destroy(&set);
+    }
+    end = mb_now();
+
+    bitset_destroy(&source);
+    return end - start;
+}
+
+/* removes one set from another, an operation is one removal */
+uint64_t mb_bitset_remove_set(const mb_case_t *c, uint64_t *ops)
+{
+    bitset_t set, other;
+    uint64_t start, end;
+
+    mb_random_set(&set, c->size, 2, 88172645463325252ull);
+    mb_random_set(&other, c->size, 2, 1181783497276652981ull);
+    *ops = 10000;
+
+    start = mb_now();
+    for(uint64_t i = 0; i < *ops; i++)
+    {
+        bitset_remove_set(&set, &other);
+        /* keeps the set from becoming empty after the first removal */
+        set.bits[i % BITSET_NUM_DATA_ELEMENTS(set.max)] ^= (bitset_data_t) i;
+    }
+    end = mb_now();
+
+    mb_sink += set.bits[0];
+    bitset_destroy(&set);
+    bitset_destroy(&other);
+    return end - start;
+}
+
+/* pushes onto a stack that starts empty, so that its growth is included */
+uint64_t mb_stack_push(const mb_case_t *c, uint64_t *ops)
+{
+    stack_t stack;
+    uint64_t start, end;
+
+    stack_init(&stack, sizeof(uint32_t));
+    *ops = c->size;
+
+    start = mb_now();
+    for(uint32_t i = 0; i < c->size; i++)
+        stack_push(&stack, &i);
+    end = mb_now();
+
+    mb_sink += stack_height(&stack);
+    stack_destroy(&stack);
+    return end - start;
+}
+
+uint64_t mb_stack_pop(const mb_case_t *c, uint64_t *ops)
+{
+    stack_t stack;
+    uint64_t start, end, sum = 0;
+    uint32_t value;
+
+    stack_init(&stack, sizeof(uint32_t));
+    for(uint32_t i = 0; i < c->size; i++)
+        stack_push(&stack, &i);
+    *ops = c->size;
+
+    start = mb_now();
+    while(stack_pop(&stack, &value))
+        sum += value;
+    end = mb_now();
+
+    mb_sink += sum;
+    stack_destroy(&stack);
+    return end - start;
+}
+
+/* looks up random values in a sorted stack, half of them are contained */
+uint64_t mb_stack_binsearch(const mb_case_t *c, uint64_t *ops)
+{
+    stack_t stack;
+    uint64_t start, end, state = 88172645463325252ull, found = 0;
+    uint32_t value, *queries;
+
+    stack_init(&stack, sizeof(uint32_t));
+    for(uint32_t i = 0; i < c->size; i++)
+    {
+        value = 2 * i;
+        stack_push(&stack, &value);
+    }
+
+    /* the queries are drawn up front so that the generator is not timed */
+    *ops = 1000000;
+    queries = (uint32_t *) malloc(sizeof(uint32_t) * *ops);
+    if(queries == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store queries\n");
+        exit(0);
+    }
+    for(uint64_t i = 0; i < *ops; i++)
+        queries[i] = (uint32_t) (mb_random(&state) % (2ull * c->size));
+
+    start = mb_now();
+    for(uint64_t i = 0; i < *ops; i++)
+        found += stack_binsearch(&stack, mb_cmp_u32, &queries[i], NULL);
+    end = mb_now();
+
+    mb_sink += found;
+    free(queries);
+    stack_destroy(&stack);
+    return end - start;
+}
+
+uint64_t mb_queue_enqueue(const mb_case_t *c, uint64_t *ops)
+{
+    queue_t queue;
+    uint64_t start, end;
+
+    queue_init(&queue, sizeof(uint32_t));
+    *ops = c->size;
+
+    start = mb_now();
+    for(uint32_t i = 0; i < c->size; i++)
+        queue_enqueue(&queue, &i);
+    end = mb_now();
+
+    mb_sink += queue_isempty(&queue);
+    queue_destroy(&queue);
+    return end - start;
+}
+
+/* the first dequeue moves all elements from the input to the output stack, its cost is spread over the operations */
+uint64_t mb_queue_dequeue(const mb_case_t *c, uint64_t *ops)
+{
+    queue_t queue;
+    uint64_t start, end, sum = 0;
+    uint32_t value;
+
+    queue_init(&queue, sizeof(uint32_t));
+    for(uint32_t i = 0; i < c->size; i++)
+        queue_enqueue(&queue, &i);
+    *ops = c->size;
+
+    start = mb_now();
+    while(queue_dequeue(&queue, &value))
+        sum += value;
+    end = mb_now();
+
+    mb_sink += sum;
+    queue_destroy(&queue);
+    return end - start;
+}
+
+/* unions of random pairs until the calls stop, an operation is one call of uf_union */
+uint64_t mb_uf_union(const mb_case_t *c, uint64_t *ops)
+{
+    uf_t uf;
+    uint64_t start, end, state = 88172645463325252ull;
+    uf_node_t *pairs;
+
+    *ops = c->size;
+    pairs = (uf_node_t *) malloc(sizeof(uf_node_t) * 2 * *ops);
+    if(pairs == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store pairs\n");
+        exit(0);
+    }
+    for(uint64_t i = 0; i < 2 * *ops; i++)
+        pairs[i] = (uf_node_t) (mb_random(&state) % c->size);
+    uf_init(&uf, c->size);
+
+    start = mb_now();
+    for(uint64_t i = 0; i < *ops; i++)
+        uf_union(&uf, pairs[2 * i], pairs[2 * i + 1]);
+    end = mb_now();
+
+    mb_sink += uf_find(&uf, 0);
+    uf_destroy(&uf);
+    free(pairs);
+    return end - start;
+}
+
+/* finds of random nodes after 'size' / 2 random unions */
+uint64_t mb_uf_find(const mb_case_t *c, uint64_t *ops)
+{
+    uf_t uf;
+    uint64_t start, end, state = 88172645463325252ull, sum = 0;
+    uf_node_t *nodes;
+
+    uf_init(&uf, c->size);
+    for(uint32_t i = 0; i < c->size / 2; i++)
+        uf_union(&uf, (uf_node_t) (mb_random(&state) % c->size), (uf_node_t) (mb_random(&state) % c->size));
+
+    *ops = c->size;
+    nodes = (uf_node_t *) malloc(sizeof(uf_node_t) * *ops);
+    if(nodes == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store nodes\n");
+        exit(0);
+    }
+    for(uint64_t i = 0; i < *ops; i++)
+        nodes[i] = (uf_node_t) (mb_random(&state) % c->size);
+
+    start = mb_now();
+    for(uint64_t i = 0; i < *ops; i++)
+        sum += uf_find(&uf, nodes[i]);
+    end = mb_now();
+
+    mb_sink += sum;
+    uf_destroy(&uf);
+    free(nodes);
+    return end - start;
+}
+
+static const mb_case_t mb_cases[] =
+{
+    { "bitset_iterate_set_and_clear/dense", 1024, mb_bitset_iterate_dense },
+    { "bitset_iterate_set_and_clear/dense", 65535, mb_bitset_iterate_dense },
+    { "bitset_iterate_set_and_clear/sparse", 65535, mb_bitset_iterate_sparse },
+    { "bitset_init_copy", 1024, mb_bitset_init_copy },
+    { "bitset_init_copy", 65535, mb_bitset_init_copy },
+    { "bitset_remove_set", 1024, mb_bitset_remove_set },
+    { "bitset_remove_set", 65535, mb_bitset_remove_set },
+    { "stack_push", 1000000, mb_stack_push },
+    { "stack_push", 4000000, mb_stack_push },
+    { "stack_pop", 1000000, mb_stack_pop },
+    { "stack_pop", 4000000, mb_stack_pop },
+    { "stack_binsearch", 65535, mb_stack_binsearch },
+    { "stack_binsearch", 4000000, mb_stack_binsearch },
+    { "queue_enqueue", 1000000, mb_queue_enqueue },
+    { "queue_enqueue", 4000000, mb_queue_enqueue },
+    { "queue_dequeue", 1000000, mb_queue_dequeue },
+    { "queue_dequeue", 4000000, mb_queue_dequeue },
+    { "uf_union", 65535, mb_uf_union },
+    { "uf_union", 1000000, mb_uf_union },
+    { "uf_find", 65535, mb_uf_find },
+    { "uf_find", 1000000, mb_uf_find }
+};
+
+/* value at 'percent' of sorted samples, by the nearest rank */
+uint64_t mb_percentile(const uint64_t *samples, uint32_t count, uint32_t percent)
+{
+    uint32_t rank = (uint32_t) (((uint64_t) percent * count + 99) / 100);
+
+    return samples[(rank > 0) ? rank - 1 : 0];
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t warmup = 3, repetitions = 15;
+    const char *filter = NULL;
+    bool csv = false;
+    uint64_t *samples, ops = 0;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "--warmup") && (i + 1 < argc))
+            warmup = (uint32_t) atoi(argv[++i]);
+        else if(!strcmp(argv[i], "--repetitions") && (i + 1 < argc))
+        {
+            int value = atoi(argv[++i]);
+            repetitions = (value > 0) ? (uint32_t) value : 1;
+        }
+        else if(!strcmp(argv[i], "--filter") && (i + 1 < argc))
+            filter = argv[++i];
+        else if(!strcmp(argv[i], "--csv"))
+            csv = true;
+        else
+        {
+            fprintf(stdout, "Usage: %s [options]\n", argv[0]);
+            fprintf(stdout, " Available options:\n");
+            fprintf(stdout, "  --warmup <n>      unmeasured repetitions of every case (default: 3)\n");
+            fprintf(stdout, "  --repetitions <n> measured repetitions of every case (default: 15)\n");
+            fprintf(stdout, "  --filter <text>   only runs the cases whose name contains the text\n");
+            fprintf(stdout, "  --csv             one line of CSV per case instead of a table\n");
+            return 0;
+        }
+    }
+
+    samples = (uint64_t *) malloc(sizeof(uint64_t) * repetitions);
+    if(samples == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store samples\n");
+        exit(0);
+    }
+
+    if(csv)
+        fprintf(stdout, "case,size,ops,min_ns,median_ns,p90_ns,max_ns\n");
+    else
+        fprintf(stdout, "%-38s %9s %9s %10s %10s %10s %10s   (ns per operation)\n", "case", "size", "ops", "min", "median", "p90", "max");
+
+    for(uint32_t i = 0; i < sizeof(mb_cases) / sizeof(mb_cases[0]); i++)
+    {
+        const mb_case_t *c = &mb_cases[i];
+        double scale;
+
+        if(filter && !strstr(c->name, filter))
+            continue;
+
+        for(uint32_t r = 0; r < warmup; r++)
+            c->run(c, &ops);
+        for(uint32_t r = 0; r < repetitions; r++)
+            samples[r] = c->run(c, &ops);
+        qsort(samples, repetitions, sizeof(uint64_t), mb_cmp_u64);
+
+        /* every repetition does the same number of operations */
+        scale = (ops > 0) ? 1.0 / ops : 0.0;
+        if(csv)
+            fprintf(stdout, "%s,%u,%" PRIu64 ",%.3f,%.3f,%.3f,%.3f\n", c->name, c->size, ops, samples[0] * scale,
+                mb_percentile(samples, repetitions, 50) * scale, mb_percentile(samples, repetitions, 90) * scale, samples[repetitions - 1] * scale);
+        else
+            fprintf(stdout, "%-38s %9u %9" PRIu64 " %10.3f %10.3f %10.3f %10.3f\n", c->name, c->size, ops, samples[0] * scale,
+                mb_percentile(samples, repetitions, 50) * scale, mb_percentile(samples, repetitions, 90) * scale, samples[repetitions - 1] * scale);
+        fflush(stdout);
+    }
+
+    free(samples);
+    return 0;
+}
@@ -5,8 +5,9 @@
  * @brief Initializes a stack.
  * @param stack Pointer to uninitialized stack.
  * @param size Size in bytes of elements the stack needs to contain.
+ * @returns `true` on success, `false` if memory ran out, the stack is empty then and allocates memory once elements are pushed.
  */
-void stack_init(stack_t *stack, uint32_t size)
+bool stack_init(stack_t *stack, uint32_t size)
 {
     assert(stack);
     assert(size > 0);
@@ -15,7 +16,40 @@ void stack_init(stack_t *stack, uint32_t size)
     stack->size = size;
     stack->allocated = 10;
     stack->data = (uint8_t *) malloc(sizeof(uint8_t) * stack->allocated * stack->size);
-    assert(stack->data);
+    if(stack->data == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store stack data\n");
+        stack->allocated = 0;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Creates a copy of a stack.
+ * @details Initializes `stack` with the element size of `source` and copies all elements of `source` to `stack`.
+ * @param stack Pointer to uninitialized stack.
+ * @param source Pointer to initialized stack that is to be copied.
+ * @returns `true` on success, `false` if memory ran out, the stack is empty then.
+ */
+bool stack_init_copy(stack_t *stack, const stack_t const *source)
+{
+    assert(stack);
+    assert(source);
+
+    stack->n = source->n;
+    stack->size = source->size;
+    stack->allocated = (source->n > 10) ? source->n : 10;
+    stack->data = (uint8_t *) malloc(sizeof(uint8_t) * stack->allocated * stack->size);
+    if(stack->data == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store stack data\n");
+        stack->n = 0;
+        stack->allocated = 0;
+        return false;
+    }
+    memcpy(stack->data, source->data, sizeof(uint8_t) * source->n * source->size);
+    return true;
 }
 
 /**
@@ -36,24 +70,79 @@ void stack_destroy(stack_t *stack)
  * @details If a stack with element size `sizeof(uint32_t)` was initialized and the value `uint32_t x = 10` is to be pushed onto the stack, `stack_push` needs to be called with `&x`.
  * @param stack Stack to push the element onto.
  * @param data Pointer to element to push.
+ * @returns `true` if the element was pushed, `false` if memory ran out, the stack is unchanged then.
  */
-void stack_push(stack_t *stack, void *data)
+bool stack_push(stack_t *stack, void *data)
 {
     assert(stack);
     assert(data);
     
-    if(stack->n == stack->allocated)
-    {
-        uint8_t *new_data = (uint8_t *) realloc(stack->data, 2 * sizeof(uint8_t) * stack->size * stack->allocated);
-        if(new_data == NULL)
-            return;
-
-        stack->data = new_data;
-        stack->allocated = stack->allocated * 2;
-    }
+    if(!stack_grow(stack, 1))
+        return false;
     
     memcpy(stack->data + stack->n * stack->size, data, stack->size);
     stack->n = stack->n + 1;
+    return true;
+}
+
+/**
+ * @brief Makes sure that a number of elements can be pushed without allocating memory.
+ * @details Doubles the memory of the stack until it can hold `num_elements` more elements than it contains, like pushing them one by one would.
+ * @param stack Stack to grow.
+ * @param num_elements Number of elements that are going to be pushed.
+ * @returns `true` on success, `false` if memory ran out, the stack is unchanged then.
+ */
+bool stack_grow(stack_t *stack, uint32_t num_elements)
+{
+    uint32_t allocated;
+    uint8_t *new_data;
+
+    assert(stack);
+
+    if(stack->n + num_elements <= stack->allocated)
+        return true;
+
+    allocated = (stack->allocated > 0) ? stack->allocated : 10;
+    while(allocated < stack->n + num_elements)
+        allocated = 2 * allocated;
+    new_data = (uint8_t *) realloc(stack->data, sizeof(uint8_t) * stack->size * (size_t) allocated);
+    if(new_data == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store stack data\n");
+        return false;
+    }
+
+    stack->data = new_data;
+    stack->allocated = allocated;
+    return true;
+}
+
+/**
+ * @brief Allocates memory for a number of elements in advance.
+ * @details Pushing elements does not allocate memory until the stack holds more than `num_elements` elements. Does nothing if enough memory is allocated already.
+ * @param stack Stack to reserve memory for.
+ * @param num_elements Number of elements the stack must be able to hold.
+ * @returns `true` on success, `false` if memory ran out, the stack is unchanged then.
+ */
+bool stack_reserve(stack_t *stack, uint32_t num_elements)
+{
+    uint8_t *new_data;
+
+    assert(stack);
+
+    if(num_elements <= stack->allocated)
+        return true;
+
+    new_data = (uint8_t *) realloc(stack->data, sizeof(uint8_t) * stack->size * (size_t) num_elements);
+    if(new_data == NULL)
+    {
+        fprintf(stderr, "Error: could not allocate memory to store stack data\n");
+        return false;
+    }
+
+    stack->data = new_data;
+    stack->allocated = num_elements;
+    return true;
 }
 
 /**
@@ -235,34 +324,23 @@ bool stack_get_element(stack_t *stack, uint32_t position, void *result)
 void stack_remove_element(stack_t *stack, int (*compar)(const void *, const void *), void *data)
 {
     uint32_t i;
-    void *tmp_data;
     assert(stack);
     assert(compar);
     assert(data);
     
-    tmp_data = malloc(stack->size);
-    if(tmp_data == NULL)
-    {
-        fprintf(stderr, "Error: could not allocate memory to store temp stack data\n");
-        exit(0);
-    }
-    
     i = 0;
     while(i < stack_height(stack))
     {
-        stack_get_element(stack, i, tmp_data);
-        if(compar(tmp_data, data) != 0)
+        if(compar(stack->data + i * stack->size, data) != 0)
             i++;
         else
         {
             /* put last element into this spot */
-            stack_pop(stack, tmp_data);
+            stack->n = stack->n - 1;
             if(i < stack_height(stack))
-                memcpy(stack->data + i * stack->size, tmp_data, stack->size);
+                memcpy(stack->data + i * stack->size, stack->data + stack->n * stack->size, stack->size);
         }
     }
-    
-    free(tmp_data);
 }
 
 /**
@@ -25,9 +25,12 @@ struct _stack_s
 };
 typedef struct _stack_s stack_t;
 
-void stack_init(stack_t *stack, uint32_t size);
+bool stack_init(stack_t *stack, uint32_t size);
+bool stack_init_copy(stack_t *stack, const stack_t const *source);
 void stack_destroy(stack_t *stack);
-void stack_push(stack_t *stack, void *data);
+bool stack_push(stack_t *stack, void *data);
+bool stack_grow(stack_t *stack, uint32_t num_elements);
+bool stack_reserve(stack_t *stack, uint32_t num_elements);
 bool stack_isempty(const stack_t const *stack);
 uint32_t stack_height(const stack_t const *stack);
 bool stack_pop(stack_t *stack, void *data);
@@ -0,0 +1,227 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include "stats.h"
+
+static const char *stats_phase_names[STATS_NUM_PHASES] = { "other", "load", "kernel", "local_search", "search" };
+
+/**
+ * @brief Returns the time of CLOCK_MONOTONIC in nanoseconds.
+ */
+static uint64_t stats_now()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * 1000000000ull + (uint64_t) now.tv_nsec;
+}
+
+/**
+ * @brief Main function of the listener thread, writes a snapshot for every SIGUSR1 until stats_destroy stops it.
+ */
+static void *stats_listener(void *data)
+{
+    stats_t *stats = (stats_t *) data;
+    sigset_t signals;
+    int signal;
+
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    while(sigwait(&signals, &signal) == 0)
+    {
+        if(__atomic_load_n(&(stats->stopping), __ATOMIC_ACQUIRE))
+            break;
+
+        fprintf(stderr, "[stats] ");
+        stats_write_json(stats, stderr);
+        fprintf(stderr, "\n");
+        fflush(stderr);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Initializes the statistics of a run, the clock starts now and the run is in phase STATS_PHASE_OTHER.
+ * @param stats Pointer to an uninitialized statistics data structure.
+ * @param rule_names Names of the counters of reduction rules, they are not copied.
+ * @param num_rules Number of counters, at most `STATS_MAX_RULES`.
+ */
+void stats_init(stats_t *stats, const char *const *rule_names, uint32_t num_rules)
+{
+    assert(stats);
+    assert(num_rules <= STATS_MAX_RULES);
+
+    memset(stats, 0, sizeof(stats_t));
+    stats->start = stats_now();
+    stats->phase = STATS_PHASE_OTHER;
+    stats->phase_start = stats->start;
+    stats->num_rules = num_rules;
+    for(uint32_t i = 0; i < num_rules; i++)
+        stats->rule_names[i] = rule_names[i];
+}
+
+/**
+ * @brief Stops the listener thread of stats_listen.
+ * @param stats Pointer to an initialized statistics data structure.
+ * @remark SIGUSR1 stays blocked in the calling thread.
+ */
+void stats_destroy(stats_t *stats)
+{
+    assert(stats);
+
+    if(!stats->listening)
+        return;
+
+    __atomic_store_n(&(stats->stopping), true, __ATOMIC_RELEASE);
+    pthread_kill(stats->listener, SIGUSR1);
+    pthread_join(stats->listener, NULL);
+    stats->listening = false;
+}
+
+/**
+ * @brief Writes a snapshot of the statistics to stderr whenever the process receives SIGUSR1.
+ * @details Blocks SIGUSR1 in the calling thread and starts a thread that waits for it, so that no thread is interrupted.
+ * @param stats Pointer to an initialized statistics data structure.
+ * @returns `false` if the listener thread could not be started.
+ * @remark Has to be called before any other thread is started, threads inherit the blocked signal from their creator.
+ */
+bool stats_listen(stats_t *stats)
+{
+    sigset_t signals;
+
+    assert(stats);
+
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGUSR1);
+    if(pthread_sigmask(SIG_BLOCK, &signals, NULL) != 0)
+        return false;
+
+    stats->listening = (pthread_create(&(stats->listener), NULL, stats_listener, stats) == 0);
+    return stats->listening;
+}
+
+/**
+ * @brief Ignores SIGUSR1, for processes that run solvers without a listener.
+ * @details The default action of SIGUSR1 ends the process, see stats_listen for processes that listen.
+ */
+void stats_ignore_signal()
+{
+    signal(SIGUSR1, SIG_IGN);
+}
+
+/**
+ * @brief Ends the current phase and starts another one.
+ * @param stats Pointer to an initialized statistics data structure.
+ * @param phase Phase that the run enters.
+ * @remark Only one thread may change phases.
+ */
+void stats_enter_phase(stats_t *stats, stats_phase_t phase)
+{
+    uint64_t now = stats_now();
+    uint32_t current = __atomic_load_n(&(stats->phase), __ATOMIC_RELAXED);
+
+    __atomic_fetch_add(&(stats->phase_time[current]), now - __atomic_load_n(&(stats->phase_start), __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+    __atomic_store_n(&(stats->phase_start), now, __ATOMIC_RELAXED);
+    __atomic_store_n(&(stats->phase), (uint32_t) phase, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Adds the work of a search to the statistics.
+ * @param stats Pointer to an initialized statistics data structure.
+ * @param nodes Number of search nodes that were visited since the last call.
+ * @param pruned Number of search nodes that were pruned since the last call.
+ * @param hits Number of applications of every reduction rule since the last call, `num_rules` entries.
+ * @remark Takes O(`num_rules`) atomic operations, searches should batch their counts.
+ */
+void stats_add(stats_t *stats, uint64_t nodes, uint64_t pruned, const uint64_t const *hits)
+{
+    if(nodes > 0)
+        __atomic_fetch_add(&(stats->nodes), nodes, __ATOMIC_RELAXED);
+    if(pruned > 0)
+        __atomic_fetch_add(&(stats->pruned), pruned, __ATOMIC_RELAXED);
+    for(uint32_t i = 0; i < stats->num_rules; i++)
+    {
+        if(hits[i] > 0)
+            __atomic_fetch_add(&(stats->hits[i]), hits[i], __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Raises the maximum depth of the statistics to `depth`.
+ */
+void stats_update_depth(stats_t *stats, uint32_t depth)
+{
+    uint32_t max_depth = __atomic_load_n(&(stats->max_depth), __ATOMIC_RELAXED);
+
+    while((depth > max_depth) && !__atomic_compare_exchange_n(&(stats->max_depth), &max_depth, depth, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+/**
+ * @brief Returns the maximum resident set size of the process in KiB.
+ */
+uint64_t stats_peak_memory()
+{
+    struct rusage usage;
+
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return (uint64_t) usage.ru_maxrss;
+}
+
+/**
+ * @brief Writes a string as a JSON string literal, including the quotes.
+ * @param file File to write to.
+ * @param string String to write.
+ */
+void stats_write_json_string(FILE *file, const char *string)
+{
+    fputc('"', file);
+    for(const unsigned char *c = (const unsigned char *) string; *c; c++)
+    {
+        if((*c == '"') || (*c == '\\'))
+            fprintf(file, "\\%c", *c);
+        else if(*c < 0x20)
+            fprintf(file, "\\u%04x", *c);
+        else
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+/**
+ * @brief Writes a snapshot of the statistics as a JSON object.
+ * @details The object has the members `time`, `phases` (seconds per phase, the current one included), `nodes`, `pruned`, `max_depth`,
+ *          `nodes_per_second` (nodes per second of phase STATS_PHASE_SEARCH), `rules` (applications per rule) and `peak_memory_kib`.
+ * @param stats Pointer to an initialized statistics data structure.
+ * @param file File to write to, no line break is written.
+ * @remark May be called while other threads update the statistics, the snapshot is not taken atomically as a whole.
+ */
+void stats_write_json(stats_t *stats, FILE *file)
+{
+    uint64_t now = stats_now(), nodes = __atomic_load_n(&(stats->nodes), __ATOMIC_RELAXED);
+    uint32_t current = __atomic_load_n(&(stats->phase), __ATOMIC_RELAXED);
+    double phase_time[STATS_NUM_PHASES];
+
+    for(uint32_t i = 0; i < STATS_NUM_PHASES; i++)
+        phase_time[i] = __atomic_load_n(&(stats->phase_time[i]), __ATOMIC_RELAXED) / 1e9;
+    phase_time[current] += (now - __atomic_load_n(&(stats->phase_start), __ATOMIC_RELAXED)) / 1e9;
+
+    fprintf(file, "{\"time\": %.3f, \"phases\": {", (now - stats->start) / 1e9);
+    for(uint32_t i = 0; i < STATS_NUM_PHASES; i++)
+        fprintf(file, "%s\"%s\": %.3f", (i > 0) ? ", " : "", stats_phase_names[i], phase_time[i]);
+    fprintf(file, "}, \"nodes\": %llu, \"pruned\": %llu, \"max_depth\": %u, \"nodes_per_second\": %.0f, \"rules\": {",
+        (unsigned long long) nodes, (unsigned long long) __atomic_load_n(&(stats->pruned), __ATOMIC_RELAXED),
+        __atomic_load_n(&(stats->max_depth), __ATOMIC_RELAXED), (phase_time[STATS_PHASE_SEARCH] > 0) ? nodes / phase_time[STATS_PHASE_SEARCH] : 0.0);
+    for(uint32_t i = 0; i < stats->num_rules; i++)
+    {
+        fprintf(file, "%s", (i > 0) ? ", " : "");
+        stats_write_json_string(file, stats->rule_names[i]);
+        fprintf(file, ": %llu", (unsigned long long) __atomic_load_n(&(stats->hits[i]), __ATOMIC_RELAXED));
+    }
+    fprintf(file, "}, \"peak_memory_kib\": %llu}", (unsigned long long) stats_peak_memory());
+}
@@ -0,0 +1,69 @@
+#ifndef STATS_H_INCLUDED
+#define STATS_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/**
+ * @defgroup Stats Live Statistics
+ * @{
+ */
+
+/** @brief Maximum number of counters of reduction rules. */
+#define STATS_MAX_RULES 16
+
+typedef enum STATS_PHASES
+{
+    /** @brief Everything that is not one of the other phases, e.g. parsing options and writing results. */
+    STATS_PHASE_OTHER,
+    STATS_PHASE_LOAD,
+    STATS_PHASE_KERNEL,
+    STATS_PHASE_LOCALSEARCH,
+    /** @brief Branching, including the reductions that are applied at search nodes. */
+    STATS_PHASE_SEARCH,
+    STATS_NUM_PHASES
+} stats_phase_t;
+
+/**
+ * @brief Counters of a solver run that any thread may update and read while the run goes on.
+ * @details All counters are accessed atomically. Searches are expected to add their counts in batches, see stats_add.
+ */
+struct _stats_s
+{
+    /** @brief Time of CLOCK_MONOTONIC in nanoseconds at which the run started. */
+    uint64_t start;
+    uint64_t nodes;
+    uint64_t pruned;
+    /** @brief Height of the deepest search node. */
+    uint32_t max_depth;
+    uint32_t num_rules;
+    const char *rule_names[STATS_MAX_RULES];
+    uint64_t hits[STATS_MAX_RULES];
+    /** @brief Current phase, the time at which it was entered and the time spent in every earlier phase in nanoseconds. */
+    uint32_t phase;
+    uint64_t phase_start;
+    uint64_t phase_time[STATS_NUM_PHASES];
+    /** @brief Thread that writes a snapshot to stderr on every SIGUSR1, see stats_listen. */
+    pthread_t listener;
+    bool listening;
+    bool stopping;
+};
+typedef struct _stats_s stats_t;
+
+void stats_init(stats_t *stats, const char *const *rule_names, uint32_t num_rules);
+void stats_destroy(stats_t *stats);
+bool stats_listen(stats_t *stats);
+void stats_ignore_signal();
+void stats_enter_phase(stats_t *stats, stats_phase_t phase);
+void stats_add(stats_t *stats, uint64_t nodes, uint64_t pruned, const uint64_t const *hits);
+void stats_update_depth(stats_t *stats, uint32_t depth);
+uint64_t stats_peak_memory();
+void stats_write_json(stats_t *stats, FILE *file);
+void stats_write_json_string(FILE *file, const char *string);
+
+/** @} */
+
+#endif
@@ -0,0 +1,381 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <sched.h>
+#include <unistd.h>
+#include "thread_pool.h"
+
+/**
+ * @brief Returns the number of processors that are currently online.
+ * @returns Number of processors, at least `1`.
+ */
+uint32_t tpool_num_cpus(void)
+{
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(num_cpus < 1)
+        return 1;
+    return (uint32_t) num_cpus;
+}
+
+/**
+ * @brief Pushes a task onto the bottom of a deque.
+ * @param deque Deque of the worker that spawned the task.
+ * @param size Size in bytes of one task.
+ * @param task Pointer to the task data.
+ * @returns `true` if the task was queued, `false` if no memory could be allocated.
+ */
+static bool tpool_deque_push(tpool_deque_t *deque, uint32_t size, const void *task)
+{
+    pthread_mutex_lock(&(deque->lock));
+
+    if(deque->bottom == deque->allocated)
+    {
+        if(deque->top > 0)
+        {
+            /* move remaining tasks to the front, stolen slots are free again */
+            memmove(deque->data, deque->data + deque->top * size, (deque->bottom - deque->top) * size);
+            deque->bottom = deque->bottom - deque->top;
+            deque->top = 0;
+        }
+        else
+        {
+            uint8_t *new_data = (uint8_t *) realloc(deque->data, 2 * sizeof(uint8_t) * size * deque->allocated);
+            if(new_data == NULL)
+            {
+                pthread_mutex_unlock(&(deque->lock));
+                return false;
+            }
+
+            deque->data = new_data;
+            deque->allocated = deque->allocated * 2;
+        }
+    }
+
+    memcpy(deque->data + deque->bottom * size, task, size);
+    deque->bottom++;
+
+    pthread_mutex_unlock(&(deque->lock));
+    return true;
+}
+
+/**
+ * @brief Removes a task from a deque.
+ * @param deque Deque.
+ * @param size Size in bytes of one task.
+ * @param task Address to copy the task data to.
+ * @param newest Takes the newest task if `true` (owner), the oldest if `false` (thief).
+ * @returns `true` if a task was removed, `false` if the deque was empty.
+ */
+static bool tpool_deque_take(tpool_deque_t *deque, uint32_t size, void *task, bool newest)
+{
+    bool found = false;
+
+    pthread_mutex_lock(&(deque->lock));
+
+    if(deque->top < deque->bottom)
+    {
+        if(newest)
+        {
+            deque->bottom--;
+            memcpy(task, deque->data + deque->bottom * size, size);
+        }
+        else
+        {
+            memcpy(task, deque->data + deque->top * size, size);
+            deque->top++;
+        }
+
+        if(deque->top == deque->bottom)
+        {
+            deque->top = 0;
+            deque->bottom = 0;
+        }
+        found = true;
+    }
+
+    pthread_mutex_unlock(&(deque->lock));
+    return found;
+}
+
+/**
+ * @brief Finds the next task for a worker.
+ * @details Takes the newest task of its own deque first. If that is empty, the oldest task of another worker is stolen, i.e. the one closest to the root of the search tree.
+ * @param worker Worker that looks for a task.
+ * @returns `true` if a task was copied to `worker->task`, `false` if no task was found.
+ */
+static bool tpool_find_task(tpool_worker_t *worker)
+{
+    tpool_t *pool = worker->pool;
+    uint32_t i, victim;
+
+    if(tpool_deque_take(&(worker->deque), pool->size, worker->task, true))
+        return true;
+
+    /* xorshift, only used to spread thieves over the victims */
+    worker->seed ^= worker->seed << 13;
+    worker->seed ^= worker->seed >> 17;
+    worker->seed ^= worker->seed << 5;
+
+    victim = worker->seed % pool->num_workers;
+    for(i = 0; i < pool->num_workers; i++, victim = (victim + 1) % pool->num_workers)
+    {
+        if(victim == worker->id)
+            continue;
+
+        if(tpool_deque_take(&(pool->workers[victim].deque), pool->size, worker->task, false))
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Main loop of a worker thread.
+ * @param data Pointer to the worker.
+ */
+static void *tpool_worker_main(void *data)
+{
+    tpool_worker_t *worker = (tpool_worker_t *) data;
+    tpool_t *pool = worker->pool;
+    bool idle = false;
+
+    while(!tpool_is_aborted(pool))
+    {
+        if(tpool_find_task(worker))
+        {
+            if(idle)
+            {
+                __atomic_sub_fetch(&(pool->idle), 1, __ATOMIC_SEQ_CST);
+                idle = false;
+            }
+
+            pool->run(worker, worker->task);
+            __atomic_sub_fetch(&(pool->pending), 1, __ATOMIC_SEQ_CST);
+        }
+        else
+        {
+            if(!idle)
+            {
+                __atomic_add_fetch(&(pool->idle), 1, __ATOMIC_SEQ_CST);
+                idle = true;
+            }
+
+            /* no running task is left that could spawn new ones */
+            if(__atomic_load_n(&(pool->pending), __ATOMIC_SEQ_CST) == 0)
+                break;
+
+            sched_yield();
+        }
+    }
+
+    if(idle)
+        __atomic_sub_fetch(&(pool->idle), 1, __ATOMIC_SEQ_CST);
+
+    return NULL;
+}
+
+/**
+ * @brief Initializes a work-stealing thread pool.
+ * @details Every worker owns a deque of tasks. Spawned tasks are pushed to the bottom of the deque of the spawning worker, idle workers steal from the top of other deques.
+ * @param pool Pointer to uninitialized pool structure.
+ * @param num_workers Number of worker threads, at least `1`.
+ * @param size Size in bytes of one task.
+ * @param run Function that executes a task.
+ * @param discard Function that releases a task that is not executed because the pool was aborted; ignored if `NULL`.
+ * @param context User data that is shared by all workers.
+ * @returns `true` on success, `false` if memory could not be allocated.
+ */
+bool tpool_init(tpool_t *pool, uint32_t num_workers, uint32_t size, tpool_task_func_t run, tpool_task_func_t discard, void *context)
+{
+    uint32_t i;
+
+    assert(pool);
+    assert(num_workers > 0);
+    assert(size > 0);
+    assert(run);
+
+    pool->num_workers = num_workers;
+    pool->size = size;
+    pool->run = run;
+    pool->discard = discard;
+    pool->context = context;
+    pool->pending = 0;
+    pool->idle = 0;
+    pool->aborted = 0;
+
+    pool->workers = (tpool_worker_t *) calloc(num_workers, sizeof(tpool_worker_t));
+    if(pool->workers == NULL)
+    {
+        fprintf(stderr, "[tpool] Error: could not allocate memory to store workers\n");
+        return false;
+    }
+
+    for(i = 0; i < num_workers; i++)
+    {
+        tpool_worker_t *worker = &(pool->workers[i]);
+
+        worker->pool = pool;
+        worker->id = i;
+        worker->seed = 2463534242u + i;
+        worker->context = NULL;
+        worker->deque.top = 0;
+        worker->deque.bottom = 0;
+        worker->deque.allocated = 16;
+        worker->deque.data = (uint8_t *) malloc(sizeof(uint8_t) * worker->deque.allocated * size);
+        worker->task = (uint8_t *) malloc(sizeof(uint8_t) * size);
+        pthread_mutex_init(&(worker->deque.lock), NULL);
+
+        if((worker->deque.data == NULL) || (worker->task == NULL))
+        {
+            fprintf(stderr, "[tpool] Error: could not allocate memory to store tasks\n");
+            pool->num_workers = i + 1;
+            tpool_destroy(pool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Destroys a thread pool.
+ * @details Tasks that were never executed are passed to the discard function before all memory is released.
+ * @param pool Pool that is not running.
+ */
+void tpool_destroy(tpool_t *pool)
+{
+    uint32_t i;
+
+    assert(pool);
+
+    if(pool->workers == NULL)
+        return;
+
+    for(i = 0; i < pool->num_workers; i++)
+    {
+        tpool_worker_t *worker = &(pool->workers[i]);
+
+        if(pool->discard && worker->deque.data && worker->task)
+        {
+            while(tpool_deque_take(&(worker->deque), pool->size, worker->task, true))
+                pool->discard(worker, worker->task);
+        }
+
+        pthread_mutex_destroy(&(worker->deque.lock));
+        free(worker->deque.data);
+        free(worker->task);
+    }
+
+    free(pool->workers);
+    pool->workers = NULL;
+    pool->num_workers = 0;
+}
+
+/**
+ * @brief Sets the user data of a worker.
+ * @param pool Initialized pool.
+ * @param id Index of the worker, needs to be smaller than the number of workers.
+ * @param context User data that is available as `worker->context` while tasks are executed.
+ */
+void tpool_set_worker_context(tpool_t *pool, uint32_t id, void *context)
+{
+    assert(pool);
+    assert(id < pool->num_workers);
+
+    pool->workers[id].context = context;
+}
+
+/**
+ * @brief Executes a task and everything it spawns on the pool.
+ * @details Blocks until all tasks finished or the pool was aborted.
+ * @param pool Initialized pool.
+ * @param task Initial task.
+ */
+void tpool_run(tpool_t *pool, void *task)
+{
+    uint32_t i, started;
+
+    assert(pool);
+    assert(task);
+
+    tpool_spawn(&(pool->workers[0]), task);
+
+    /* the calling thread acts as worker 0 */
+    for(started = 1; started < pool->num_workers; started++)
+    {
+        if(pthread_create(&(pool->workers[started].thread), NULL, tpool_worker_main, &(pool->workers[started])) != 0)
+        {
+            fprintf(stderr, "[tpool] Warning: could only start %u worker(s)\n", started);
+            break;
+        }
+    }
+
+    tpool_worker_main(&(pool->workers[0]));
+
+    for(i = 1; i < started; i++)
+        pthread_join(pool->workers[i].thread, NULL);
+}
+
+/**
+ * @brief Spawns a new task.
+ * @details The task is pushed onto the deque of `worker` and either executed by `worker` later on or stolen by another worker. If it can't be queued, it is executed immediately.
+ * @param worker Worker that executes the current task.
+ * @param task Pointer to the task data, which is copied.
+ */
+void tpool_spawn(tpool_worker_t *worker, void *task)
+{
+    tpool_t *pool = worker->pool;
+
+    __atomic_add_fetch(&(pool->pending), 1, __ATOMIC_SEQ_CST);
+    if(!tpool_deque_push(&(worker->deque), pool->size, task))
+    {
+        pool->run(worker, task);
+        __atomic_sub_fetch(&(pool->pending), 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * @brief Returns the number of tasks that wait in the deque of a worker.
+ * @param worker Worker.
+ * @returns Number of tasks that were spawned by `worker` and were neither executed nor stolen yet.
+ */
+uint32_t tpool_num_queued(tpool_worker_t *worker)
+{
+    uint32_t queued;
+
+    pthread_mutex_lock(&(worker->deque.lock));
+    queued = worker->deque.bottom - worker->deque.top;
+    pthread_mutex_unlock(&(worker->deque.lock));
+
+    return queued;
+}
+
+/**
+ * @brief Stops all workers.
+ * @details Workers finish the task they are executing and do not start new ones. Tasks should check tpool_is_aborted to stop early.
+ * @param pool Running pool.
+ */
+void tpool_abort(tpool_t *pool)
+{
+    __atomic_store_n(&(pool->aborted), 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Tests whether a pool was aborted.
+ * @param pool Pool.
+ * @returns `true` if tpool_abort was called, `false` otherwise.
+ */
+bool tpool_is_aborted(const tpool_t const *pool)
+{
+    return (__atomic_load_n(&(pool->aborted), __ATOMIC_RELAXED) != 0);
+}
+
+/**
+ * @brief Returns the number of workers that are currently looking for work.
+ * @param pool Pool.
+ * @returns Number of idle workers.
+ */
+uint32_t tpool_num_idle(const tpool_t const *pool)
+{
+    return __atomic_load_n(&(pool->idle), __ATOMIC_RELAXED);
+}
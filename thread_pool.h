@@ -0,0 +1,89 @@
+#ifndef THREAD_POOL_H_INCLUDED
+#define THREAD_POOL_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/**
+ * @defgroup ThreadPool Thread Pool
+ * @{
+ */
+
+struct _tpool_worker_s;
+
+/** @brief Function that executes (or discards) a task. `task` points to a copy of the data that was passed to tpool_spawn. */
+typedef void (*tpool_task_func_t)(struct _tpool_worker_s *worker, void *task);
+
+struct _tpool_deque_s
+{
+    /** @brief Protects all other members of the deque. */
+    pthread_mutex_t lock;
+    /** @brief Position of the oldest task, this is where other workers steal from. */
+    uint32_t top;
+    /** @brief Position after the newest task, this is where the owner pushes and pops. */
+    uint32_t bottom;
+    /** @brief Number of slots that are allocated. */
+    uint32_t allocated;
+    /** @brief Pointer to raw task data. */
+    uint8_t *data;
+};
+typedef struct _tpool_deque_s tpool_deque_t;
+
+struct _tpool_worker_s
+{
+    /** @brief Pool this worker belongs to. */
+    struct _tpool_s *pool;
+    /** @brief Index of this worker inside the pool. */
+    uint32_t id;
+    /** @brief State of the random generator used to select victims. */
+    uint32_t seed;
+    /** @brief Tasks that were spawned by this worker. */
+    tpool_deque_t deque;
+    /** @brief Buffer that holds the task that is currently executed. */
+    uint8_t *task;
+    /** @brief User data of this worker. */
+    void *context;
+    pthread_t thread;
+};
+typedef struct _tpool_worker_s tpool_worker_t;
+
+struct _tpool_s
+{
+    /** @brief Number of worker threads. */
+    uint32_t num_workers;
+    /** @brief Size in bytes of one task. */
+    uint32_t size;
+    /** @brief Function that executes a task. */
+    tpool_task_func_t run;
+    /** @brief Function that releases a task that will never be executed; ignored if `NULL`. */
+    tpool_task_func_t discard;
+    /** @brief User data that is shared by all workers. */
+    void *context;
+    tpool_worker_t *workers;
+    /** @brief Number of tasks that were spawned but did not finish yet, accessed atomically. */
+    uint32_t pending;
+    /** @brief Number of workers that are looking for work, accessed atomically. */
+    uint32_t idle;
+    /** @brief Set once the pool is to stop, accessed atomically. */
+    int aborted;
+};
+typedef struct _tpool_s tpool_t;
+
+uint32_t tpool_num_cpus(void);
+bool tpool_init(tpool_t *pool, uint32_t num_workers, uint32_t size, tpool_task_func_t run, tpool_task_func_t discard, void *context);
+void tpool_destroy(tpool_t *pool);
+void tpool_set_worker_context(tpool_t *pool, uint32_t id, void *context);
+void tpool_run(tpool_t *pool, void *task);
+void tpool_spawn(tpool_worker_t *worker, void *task);
+uint32_t tpool_num_queued(tpool_worker_t *worker);
+void tpool_abort(tpool_t *pool);
+bool tpool_is_aborted(const tpool_t const *pool);
+uint32_t tpool_num_idle(const tpool_t const *pool);
+
+/** @} */
+
+#endif
@@ -0,0 +1,157 @@
+#include <assert.h>
+#include "ttable.h"
+
+/**
+ * @brief Initializes a table that remembers sets of vertices without a small vc.
+ * @details Allocates as many entries as fit into `max_bytes`, the table is disabled if not even one bucket fits.
+ * @param table Pointer to an uninitialized table.
+ * @param num_values Number of values the stored sets can contain.
+ * @param max_bytes Memory limit of the entries and their sets.
+ * @returns `true` on success, `false` if memory ran out, the table can be destroyed either way.
+ * @remark Allocates at most `max_bytes` memory.
+ */
+bool tt_init(tt_t *table, bitset_index_t num_values, uint64_t max_bytes)
+{
+    uint64_t num_buckets;
+
+    assert(table);
+
+    table->max = num_values;
+    table->set_size = (uint32_t) BITSET_NUM_DATA_ELEMENTS(num_values);
+    num_buckets = max_bytes / ((sizeof(tt_entry_t) + sizeof(bitset_data_t) * table->set_size) * TT_BUCKET_SIZE);
+    if(num_buckets > UINT32_MAX / TT_BUCKET_SIZE)
+        num_buckets = UINT32_MAX / TT_BUCKET_SIZE;
+    table->num_entries = (uint32_t) num_buckets * TT_BUCKET_SIZE;
+    table->entries = NULL;
+    table->sets = NULL;
+
+    if(table->num_entries == 0)
+        return true;
+
+    table->entries = (tt_entry_t *) calloc(table->num_entries, sizeof(tt_entry_t));
+    table->sets = (bitset_data_t *) malloc(sizeof(bitset_data_t) * table->set_size * (uint64_t) table->num_entries + 1);
+    if((table->entries == NULL) || (table->sets == NULL))
+    {
+        fprintf(stderr, "[ttable] Error: could not allocate memory to store transposition table\n");
+        tt_destroy(table);
+        table->entries = NULL;
+        table->sets = NULL;
+        table->num_entries = 0;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Frees memory that was allocated by tt_init.
+ * @param table Pointer to an initialized table.
+ */
+void tt_destroy(tt_t *table)
+{
+    assert(table);
+
+    free(table->entries);
+    free(table->sets);
+}
+
+/**
+ * @brief Checks whether a table stores anything.
+ * @param table Pointer to an initialized table.
+ * @returns `false` if tt_init could not fit a single bucket into its memory limit.
+ */
+bool tt_is_enabled(const tt_t const *table)
+{
+    return table->num_entries > 0;
+}
+
+/**
+ * @brief Returns the first entry of the bucket of a hash.
+ */
+static uint32_t tt_bucket(const tt_t const *table, uint64_t hash)
+{
+    return (uint32_t) (hash % (table->num_entries / TT_BUCKET_SIZE)) * TT_BUCKET_SIZE;
+}
+
+/**
+ * @brief Checks whether an entry stores a set.
+ */
+static bool tt_entry_matches(const tt_t const *table, uint32_t entry, const bitset_t const *set, uint64_t hash)
+{
+    bitset_t stored;
+
+    if((table->entries[entry].k == 0) || (table->entries[entry].hash != hash))
+        return false;
+
+    stored.max = table->max;
+    stored.bits = table->sets + (uint64_t) entry * table->set_size;
+    return bitset_cmp(&stored, set) == 0;
+}
+
+/**
+ * @brief Checks whether a set is known to have no vc of a given size.
+ * @param table Pointer to an initialized table.
+ * @param set Set of vertices with `num_values` values, see tt_init.
+ * @param hash Hash of `set`, see bitset_hash.
+ * @param k Size of the vc.
+ * @returns `true` if `set` was inserted with a k that is not smaller than `k`.
+ * @remark Takes O(`num_values` / 64) time.
+ */
+bool tt_lookup(const tt_t const *table, const bitset_t const *set, uint64_t hash, uint32_t k)
+{
+    uint32_t first;
+
+    if(table->num_entries == 0)
+        return false;
+
+    first = tt_bucket(table, hash);
+    for(uint32_t entry = first; entry < first + TT_BUCKET_SIZE; entry++)
+    {
+        if(tt_entry_matches(table, entry, set, hash))
+            return table->entries[entry].k >= k;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Remembers that a set has no vc of a given size.
+ * @details Updates the entry of `set` if it is stored already. Otherwise it takes an unused entry of its bucket, or replaces the entry with the smallest k, which is the cheapest to solve again.
+ * @param table Pointer to an initialized table.
+ * @param set Set of vertices with `num_values` values, see tt_init.
+ * @param hash Hash of `set`, see bitset_hash.
+ * @param k Size of the vc, must be positive.
+ * @returns `true` if another set was evicted.
+ */
+bool tt_insert(tt_t *table, const bitset_t const *set, uint64_t hash, uint32_t k)
+{
+    uint32_t first, victim;
+
+    if(table->num_entries == 0)
+        return false;
+
+    first = tt_bucket(table, hash);
+    victim = first;
+    for(uint32_t entry = first; entry < first + TT_BUCKET_SIZE; entry++)
+    {
+        if(tt_entry_matches(table, entry, set, hash))
+        {
+            if(table->entries[entry].k < k)
+                table->entries[entry].k = k;
+            return false;
+        }
+
+        if(table->entries[entry].k < table->entries[victim].k)
+            victim = entry;
+    }
+
+    table->entries[victim].hash = hash;
+    memcpy(table->sets + (uint64_t) victim * table->set_size, set->bits, sizeof(bitset_data_t) * table->set_size);
+    if(table->entries[victim].k > 0)
+    {
+        table->entries[victim].k = k;
+        return true;
+    }
+
+    table->entries[victim].k = k;
+    return false;
+}
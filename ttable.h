@@ -0,0 +1,49 @@
+#ifndef TTABLE_H_INCLUDED
+#define TTABLE_H_INCLUDED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "bitset.h"
+
+/**
+ * @defgroup TTable Transposition Table
+ * @{
+ */
+
+/** @brief Number of entries that a set can be stored in, the entry with the smallest k is replaced once all of them are used. */
+#define TT_BUCKET_SIZE 4
+
+struct _tt_entry_s
+{
+    /** @brief Hash of the stored set, see bitset_hash. */
+    uint64_t hash;
+    /** @brief The stored set has no vc of size at most k, 0 if the entry is unused. */
+    uint32_t k;
+};
+typedef struct _tt_entry_s tt_entry_t;
+
+struct _tt_s
+{
+    /** @brief Number of values the stored sets can contain. */
+    bitset_index_t max;
+    /** @brief Number of entries, a multiple of `TT_BUCKET_SIZE`, 0 if the table is disabled. */
+    uint32_t num_entries;
+    /** @brief Number of `bitset_data_t` elements of one stored set. */
+    uint32_t set_size;
+    tt_entry_t *entries;
+    /** @brief Elements of the set of every entry. */
+    bitset_data_t *sets;
+};
+typedef struct _tt_s tt_t;
+
+bool tt_init(tt_t *table, bitset_index_t num_values, uint64_t max_bytes);
+void tt_destroy(tt_t *table);
+bool tt_is_enabled(const tt_t const *table);
+bool tt_lookup(const tt_t const *table, const bitset_t const *set, uint64_t hash, uint32_t k);
+bool tt_insert(tt_t *table, const bitset_t const *set, uint64_t hash, uint32_t k);
+
+/** @} */
+
+#endif
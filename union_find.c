@@ -6,34 +6,37 @@
  * @details Each node belongs to its own component after initialization.
  * @param uf Pointer to uninitialized uf data structure.
  * @param num_nodes Number of nodes that need to be kept track of.
+ * @returns `true` on success, `false` if `num_nodes` is zero or memory ran out, the data structure can be destroyed either way.
  * @remark Allocates O(`num_nodes`) memory.
  */
-void uf_init(uf_t *uf, uf_node_t num_nodes)
+bool uf_init(uf_t *uf, uf_node_t num_nodes)
 {
     uf_node_t i;
     
     if(uf == NULL)
     {
         fprintf(stderr, "Error: null pointer in uf_init\n");
-        exit(0);
+        return false;
     }
     
+    uf->num_nodes = num_nodes;
+    uf->parents = NULL;
     if(num_nodes == 0)
     {
         fprintf(stderr, "Error: can't create union-find data structure without nodes\n");
-        exit(0);
+        return false;
     }
     
-    uf->num_nodes = num_nodes;
     uf->parents = (uf_node_t *) malloc(sizeof(uf_node_t) * num_nodes);
     if(uf->parents == NULL)
     {
         fprintf(stderr, "Error: could not allocate memory for union-find data structure\n");
-        exit(0);
+        return false;
     }
     
     for(i = 0; i < num_nodes; i++)
         uf->parents[i] = i;
+    return true;
 }
 
 /**
@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 
 /**
  * @defgroup UnionFind Union-Find
@@ -22,7 +23,7 @@ struct _union_find_s
 };
 typedef struct _union_find_s uf_t;
 
-void uf_init(uf_t *uf, uf_node_t num_nodes);
+bool uf_init(uf_t *uf, uf_node_t num_nodes);
 void uf_copy(uf_t *dest, uf_t *src);
 void uf_destroy(uf_t *uf);
 uf_node_t uf_find(uf_t *uf, uf_node_t node);